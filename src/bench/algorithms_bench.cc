@@ -0,0 +1,122 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "algorithms.h"
+#include "bench.h"
+
+/*The element loops the algorithms fall back to, kept from being turned into mem* calls by GCC*/
+#if defined(__GNUC__) && !defined(__clang__)
+#define ELEMENT_LOOP __attribute__((noinline, optimize("no-tree-loop-distribute-patterns")))
+#else
+#define ELEMENT_LOOP __attribute__((noinline))
+#endif
+
+template<typename T>
+ELEMENT_LOOP void loop_fill(T* first, T* last, T value) {
+    for (; first != last; ++first) {
+        *first = value;
+    }
+}
+
+template<typename T>
+ELEMENT_LOOP void loop_copy(const T* first, const T* last, T* out) {
+    for (; first != last; ++first, ++out) {
+        *out = *first;
+    }
+}
+
+template<typename T>
+ELEMENT_LOOP bool loop_equal(const T* first1, const T* last1, const T* first2) {
+    for (; first1 != last1; ++first1, ++first2) {
+        if (!(*first1 == *first2)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+ELEMENT_LOOP int loop_compare(const T* first1, const T* last1, const T* first2, const T* last2) {
+    for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
+        if (*first1 < *first2) {
+            return -1;
+        }
+        if (*first2 < *first1) {
+            return 1;
+        }
+    }
+    return first1 != last1 ? 1 : (first2 != last2 ? -1 : 0);
+}
+
+struct Record {
+    std::uint64_t id;
+    std::uint32_t flags;
+    std::uint32_t owner;
+};
+
+template<typename T>
+T make_value(std::size_t i) {
+    return static_cast<T>(i);
+}
+
+template<>
+Record make_value<Record>(std::size_t i) {
+    return Record{i, 1, 2};
+}
+
+template<typename T>
+void run_type(const char* type) {
+    for (std::size_t size : {16u, 256u, 4096u, 65536u}) {
+        std::vector<T> a(size), b(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            a[i] = b[i] = make_value<T>(i);
+        }
+        std::size_t iterations = (std::size_t(1) << 26) / (size * sizeof(T)) + 1;
+
+        auto report = [&](const char* algorithm, double dispatched, double loop) {
+            std::string name = std::string(type) + " " + algorithm + ", " + std::to_string(size) + " elements";
+            bench::report((name + ", dispatched").c_str(), dispatched);
+            bench::report((name + ", loop").c_str(), loop);
+            std::printf("%-48s %10.2fx\n", "", loop / dispatched);
+        };
+
+        report("copy", bench::ns_per_op(iterations, [&](std::size_t) {
+            algorithms::copy(b.data(), b.data() + size, a.data());
+            bench::clobber();
+        }), bench::ns_per_op(iterations, [&](std::size_t) {
+            loop_copy<T>(b.data(), b.data() + size, a.data());
+            bench::clobber();
+        }));
+        if constexpr (algorithms::is_memcmp_equality_comparable_v<T*, T*>) {
+            report("equal", bench::ns_per_op(iterations, [&](std::size_t) {
+                bench::do_not_optimize(algorithms::equal(a.data(), a.data() + size, b.data()));
+            }), bench::ns_per_op(iterations, [&](std::size_t) {
+                bench::do_not_optimize(loop_equal<T>(a.data(), a.data() + size, b.data()));
+            }));
+        }
+        if constexpr (sizeof(T) == 1) {
+            report("compare", bench::ns_per_op(iterations, [&](std::size_t) {
+                bench::do_not_optimize(algorithms::compare(a.data(), a.data() + size, b.data(), b.data() + size));
+            }), bench::ns_per_op(iterations, [&](std::size_t) {
+                bench::do_not_optimize(loop_compare<T>(a.data(), a.data() + size, b.data(), b.data() + size));
+            }));
+            report("fill", bench::ns_per_op(iterations, [&](std::size_t i) {
+                algorithms::fill(a.data(), a.data() + size, static_cast<T>(i));
+                bench::clobber();
+            }), bench::ns_per_op(iterations, [&](std::size_t i) {
+                loop_fill(a.data(), a.data() + size, static_cast<T>(i));
+                bench::clobber();
+            }));
+        }
+    }
+}
+
+int main() {
+    std::printf("ns per call, then the speedup of the dispatched algorithm over the loop\n");
+    run_type<std::uint8_t>("uint8");
+    run_type<std::int32_t>("int32");
+    run_type<double>("double");
+    run_type<Record>("Record");
+    return 0;
+}
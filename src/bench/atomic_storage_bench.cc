@@ -0,0 +1,104 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "atomic_storage.h"
+#include "bench.h"
+
+using namespace concurrency;
+
+struct Metrics {
+    std::uint64_t requests;
+    std::uint64_t errors;
+    std::uint64_t bytes_in;
+    std::uint64_t bytes_out;
+    std::uint64_t p50_us;
+    std::uint64_t p99_us;
+};
+
+struct Flags {
+    std::uint32_t generation;
+    std::uint32_t mask;
+};
+
+template<typename T>
+class mutex_cell {
+    public:
+        T load() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return value_;
+        }
+
+        void store(const T& value) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            value_ = value;
+        }
+
+    private:
+        mutable std::mutex mutex_;
+        T value_{};
+};
+
+/*Total reads per second with `readers` threads and one writer publishing every ~10us*/
+template<typename Cell, typename T>
+double reads_per_second(int readers) {
+    Cell cell;
+    std::atomic<bool> stop{false};
+    std::atomic<std::uint64_t> total{0};
+
+    std::thread writer([&] {
+        T value{};
+        for (std::uint32_t generation = 1; !stop.load(std::memory_order_relaxed); ++generation) {
+            std::memcpy(&value, &generation, sizeof(generation));
+            cell.store(value);
+            std::this_thread::sleep_for(std::chrono::microseconds(10));
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (int r = 0; r < readers; ++r) {
+        threads.emplace_back([&] {
+            std::uint64_t reads = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int i = 0; i < 64; ++i) {
+                    bench::do_not_optimize(cell.load());
+                }
+                reads += 64;
+            }
+            total += reads;
+        });
+    }
+
+    auto duration = std::chrono::milliseconds(200);
+    std::this_thread::sleep_for(duration);
+    stop = true;
+    writer.join();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return total.load() / std::chrono::duration<double>(duration).count();
+}
+
+template<typename T>
+void run(const char* title) {
+    std::printf("%s (%zu bytes, atomic_storage is %s), ns per read over all readers\n", title, sizeof(T),
+                atomic_storage<T>::is_lock_free ? "std::atomic" : "seqlock");
+    for (int readers = 1; readers <= 64; readers *= 2) {
+        std::string fast = std::string(title) + ", atomic_storage, " + std::to_string(readers) + " readers";
+        std::string locked = std::string(title) + ", mutex, " + std::to_string(readers) + " readers";
+        bench::report(fast.c_str(), 1e9 / reads_per_second<atomic_storage<T>, T>(readers));
+        bench::report(locked.c_str(), 1e9 / reads_per_second<mutex_cell<T>, T>(readers));
+    }
+}
+
+int main() {
+    std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+    run<Flags>("flags snapshot");
+    run<Metrics>("metrics snapshot");
+    return 0;
+}
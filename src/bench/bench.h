@@ -0,0 +1,72 @@
+#ifndef INCLUDE_BENCH_H
+#define INCLUDE_BENCH_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+
+#include "instrumentation.h"
+
+/*Timing helpers shared by the benchmarks, every timing also goes to the instrumentation report*/
+namespace bench {
+    template<typename T>
+    inline void do_not_optimize(T const& value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    inline void clobber() {
+        asm volatile("" : : : "memory");
+    }
+
+    /*Best of `runs` timings of f(i) for i in [0, iterations), in ns per call*/
+    template<typename F>
+    double ns_per_op(std::size_t iterations, F&& f, int runs = 5) {
+        if (iterations == 0) {
+            return 0;
+        }
+        double best = 0;
+        for (int r = 0; r < runs; ++r) {
+            std::uint64_t start = instrumentation::wall_ns();
+            for (std::size_t i = 0; i < iterations; ++i) {
+                f(i);
+            }
+            double ns = static_cast<double>(instrumentation::wall_ns() - start) / iterations;
+            best = r == 0 ? ns : std::min(best, ns);
+        }
+        return best;
+    }
+
+    inline void report(const char* name, double ns) {
+        std::printf("%-48s %10.2f ns/op\n", name, ns);
+
+        instrumentation::sample result;
+        result.name = name;
+        result.wall_ns = ns;
+        instrumentation::recorder::instance().add(result);
+    }
+
+    /*
+     * Best of `runs` measurements of f(i) for i in [0, iterations), printed and recorded
+     * with CPU time, allocations and counters of that run. Returns ns per call.
+     */
+    template<typename F>
+    double run(const char* name, std::size_t iterations, F&& f, int runs = 5) {
+        instrumentation::sample best;
+        for (int r = 0; r < runs; ++r) {
+            instrumentation::scope measured(name, iterations);
+            for (std::size_t i = 0; i < iterations; ++i) {
+                f(i);
+            }
+            instrumentation::sample result = measured.measure();
+            if (r == 0 || result.wall_ns < best.wall_ns) {
+                best = result;
+            }
+        }
+        double ns = best.ns_per_op();
+        std::printf("%-48s %10.2f ns/op\n", name, ns);
+        instrumentation::recorder::instance().add(best);
+        return ns;
+    }
+}
+
+#endif
@@ -0,0 +1,27 @@
+# Times one syntax-only compile of SOURCE per TRAITS variant, run by the transformations_compile_bench target:
+#     cmake -DCOMPILER=<c++> -DSOURCE=<file> -DINCLUDE_DIR=<dir> -P compile_time.cmake
+# Note : sub-second resolution needs CMake 3.23 (%f in string(TIMESTAMP)), whole seconds before.
+cmake_minimum_required(VERSION 3.16)
+
+set(labels "types only" "type_trait.h" "<type_traits>")
+
+if(CMAKE_VERSION VERSION_LESS 3.23)
+    set(stamp "%s")
+    set(to_ms "* 1000")
+else()
+    set(stamp "%s%f")
+    set(to_ms "/ 1000")
+endif()
+
+foreach(variant RANGE 2)
+    list(GET labels ${variant} label)
+    string(TIMESTAMP start "${stamp}" UTC)
+    execute_process(COMMAND ${COMPILER} -std=c++17 -fsyntax-only -I${INCLUDE_DIR} -DTRAITS=${variant} ${SOURCE}
+                    RESULT_VARIABLE result)
+    string(TIMESTAMP stop "${stamp}" UTC)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${label} : compile failed")
+    endif()
+    math(EXPR elapsed "(${stop} - ${start}) ${to_ms}")
+    message("${label} : ${elapsed} ms")
+endforeach()
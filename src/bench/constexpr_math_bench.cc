@@ -0,0 +1,78 @@
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "constexpr_math.h"
+#include "bench.h"
+
+int main() {
+    constexpr std::size_t count = 1 << 16;
+    std::vector<std::uint64_t> words(count);
+    std::vector<double> values(count);
+    std::uint64_t state = 1;
+    for (std::size_t i = 0; i < count; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        words[i] = state | 1;
+        values[i] = static_cast<double>(state >> 11) * 1e-6;
+    }
+    std::vector<double> roots(count);
+    std::vector<std::uint64_t> target(count);
+
+    /*Each pair : the dual-path kernel at runtime, then the intrinsic it should match*/
+    bench::run("popcount, constexpr_math", count, [&](std::size_t i) {
+        bench::do_not_optimize(constexpr_math::popcount(words[i]));
+    });
+    bench::run("popcount, __builtin_popcountll", count, [&](std::size_t i) {
+        bench::do_not_optimize(__builtin_popcountll(words[i]));
+    });
+    bench::run("clz, constexpr_math", count, [&](std::size_t i) {
+        bench::do_not_optimize(constexpr_math::clz(words[i]));
+    });
+    bench::run("clz, __builtin_clzll", count, [&](std::size_t i) {
+        bench::do_not_optimize(__builtin_clzll(words[i]));
+    });
+    bench::run("log2, constexpr_math", count, [&](std::size_t i) {
+        bench::do_not_optimize(constexpr_math::log2(words[i]));
+    });
+    bench::run("log2, 63 - __builtin_clzll", count, [&](std::size_t i) {
+        bench::do_not_optimize(63 - __builtin_clzll(words[i]));
+    });
+    bench::run("sqrt, constexpr_math", count, [&](std::size_t i) {
+        bench::do_not_optimize(constexpr_math::sqrt(values[i]));
+    });
+    bench::run("sqrt, std::sqrt", count, [&](std::size_t i) {
+        bench::do_not_optimize(std::sqrt(values[i]));
+    });
+
+    /*Array kernels, per element*/
+    bench::report("popcount array, constexpr_math", bench::ns_per_op(1, [&](std::size_t) {
+        bench::do_not_optimize(constexpr_math::popcount(words.data(), count));
+    }, 20) / count);
+    bench::report("popcount array, __builtin_popcountll loop", bench::ns_per_op(1, [&](std::size_t) {
+        std::size_t total = 0;
+        for (std::uint64_t word : words) {
+            total += __builtin_popcountll(word);
+        }
+        bench::do_not_optimize(total);
+    }, 20) / count);
+    bench::report("sqrt array, constexpr_math", bench::ns_per_op(1, [&](std::size_t) {
+        constexpr_math::sqrt(values.data(), count, roots.data());
+        bench::clobber();
+    }, 20) / count);
+    bench::report("sqrt array, std::sqrt loop", bench::ns_per_op(1, [&](std::size_t) {
+        for (std::size_t i = 0; i < count; ++i) {
+            roots[i] = std::sqrt(values[i]);
+        }
+        bench::clobber();
+    }, 20) / count);
+    bench::report("copy, constexpr_math", bench::ns_per_op(1, [&](std::size_t) {
+        constexpr_math::copy(words.data(), count, target.data());
+        bench::clobber();
+    }, 20) / count);
+    bench::report("copy, std::memcpy", bench::ns_per_op(1, [&](std::size_t) {
+        std::memcpy(target.data(), words.data(), count * sizeof(std::uint64_t));
+        bench::clobber();
+    }, 20) / count);
+    return 0;
+}
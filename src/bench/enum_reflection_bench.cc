@@ -0,0 +1,65 @@
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "enum_reflection.h"
+#include "bench.h"
+
+enum class Message {
+    Logon, Logout, Heartbeat, TestRequest, ResendRequest, Reject, SequenceReset,
+    NewOrderSingle, OrderCancelRequest, OrderCancelReplaceRequest, OrderStatusRequest,
+    ExecutionReport, OrderCancelReject, MarketDataRequest, MarketDataSnapshot,
+    MarketDataIncrementalRefresh, MarketDataRequestReject, SecurityDefinitionRequest,
+    SecurityDefinition, SecurityStatusRequest, SecurityStatus, TradingSessionStatus,
+    MassQuote, QuoteCancel, QuoteRequest, Quote, QuoteAcknowledgement, News, Email,
+    BusinessMessageReject, TradeCaptureReport, PositionReport
+};
+
+int main() {
+    using namespace enum_reflection;
+
+    constexpr std::size_t iterations = 1 << 22;
+
+    /*Mix of hits and misses, as a decoder sees them*/
+    std::vector<std::string> inputs;
+    for (std::string_view name : enum_names_v<Message>) {
+        inputs.emplace_back(name);
+    }
+    inputs.emplace_back("Unknown");
+    inputs.emplace_back("Logonx");
+    const std::size_t n = inputs.size();
+
+    std::unordered_map<std::string_view, Message> hashed;
+    std::map<std::string_view, Message> ordered;
+    std::unordered_map<Message, std::string_view> names;
+    for (std::size_t i = 0; i < enum_count_v<Message>; ++i) {
+        hashed.emplace(enum_names_v<Message>[i], enum_values_v<Message>[i]);
+        ordered.emplace(enum_names_v<Message>[i], enum_values_v<Message>[i]);
+        names.emplace(enum_values_v<Message>[i], enum_names_v<Message>[i]);
+    }
+
+    std::printf("string -> enum (%zu enumerators)\n", enum_count_v<Message>);
+    bench::report("enum_cast (constexpr perfect hash)", bench::ns_per_op(iterations, [&](std::size_t i) {
+        bench::do_not_optimize(enum_cast<Message>(inputs[i % n]));
+    }));
+    bench::report("std::unordered_map<string_view, E>", bench::ns_per_op(iterations, [&](std::size_t i) {
+        auto it = hashed.find(inputs[i % n]);
+        bench::do_not_optimize(it == hashed.end() ? Message::Logon : it->second);
+    }));
+    bench::report("std::map<string_view, E>", bench::ns_per_op(iterations, [&](std::size_t i) {
+        auto it = ordered.find(inputs[i % n]);
+        bench::do_not_optimize(it == ordered.end() ? Message::Logon : it->second);
+    }));
+
+    std::printf("enum -> string\n");
+    bench::report("enum_name (dense table)", bench::ns_per_op(iterations, [&](std::size_t i) {
+        bench::do_not_optimize(enum_name(enum_values_v<Message>[i % enum_count_v<Message>]));
+    }));
+    bench::report("std::unordered_map<E, string_view>", bench::ns_per_op(iterations, [&](std::size_t i) {
+        bench::do_not_optimize(names.find(enum_values_v<Message>[i % enum_count_v<Message>])->second);
+    }));
+
+    return 0;
+}
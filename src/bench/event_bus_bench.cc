@@ -0,0 +1,108 @@
+#include <functional>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "event_bus.h"
+#include "bench.h"
+
+using namespace callables;
+
+struct Tick {
+    std::uint64_t frame;
+    double dt;
+};
+
+struct Physics {
+    double time = 0;
+    void on_tick(const Tick& tick) { time += tick.dt; }
+};
+
+struct Animation {
+    std::uint64_t frames = 0;
+    void on_tick(const Tick& tick) { frames = tick.frame; }
+};
+
+struct Audio {
+    double clock = 0;
+    void on_tick(const Tick& tick) noexcept { clock += tick.dt * 0.5; }
+};
+
+std::uint64_t ticks = 0;
+void count_tick(const Tick&) { ++ticks; }
+
+/*What the tick path uses today : handlers type-erased per event type*/
+class function_bus {
+    public:
+        template<typename Event>
+        void subscribe(std::function<void(const Event&)> handler) {
+            handlers_[typeid(Event)].emplace_back([handler = std::move(handler)](const void* event) {
+                handler(*static_cast<const Event*>(event));
+            });
+        }
+
+        template<typename Event>
+        void publish(const Event& event) const {
+            auto it = handlers_.find(typeid(Event));
+            if (it != handlers_.end()) {
+                for (const auto& handler : it->second) {
+                    handler(&event);
+                }
+            }
+        }
+
+    private:
+        std::unordered_map<std::type_index, std::vector<std::function<void(const void*)>>> handlers_;
+};
+
+int main() {
+    constexpr std::size_t iterations = 1 << 24;
+
+    Physics physics;
+    Animation animation;
+    Audio audio;
+
+    auto bus = make_event_bus<&count_tick, &Physics::on_tick, &Animation::on_tick, &Audio::on_tick>(physics, animation, audio);
+
+    std::vector<delegate<void(const Tick&)>> delegates = {
+        make_delegate<&count_tick>(),
+        make_delegate<&Physics::on_tick>(physics),
+        make_delegate<&Animation::on_tick>(animation),
+        make_delegate<&Audio::on_tick>(audio)};
+
+    std::vector<std::function<void(const Tick&)>> functions = {
+        count_tick,
+        [&physics](const Tick& tick) { physics.on_tick(tick); },
+        [&animation](const Tick& tick) { animation.on_tick(tick); },
+        [&audio](const Tick& tick) { audio.on_tick(tick); }};
+
+    function_bus erased;
+    for (const auto& function : functions) {
+        erased.subscribe<Tick>(function);
+    }
+
+    std::printf("publish one Tick to 4 handlers\n");
+    bench::report("event_bus (compile-time wired)", bench::ns_per_op(iterations, [&](std::size_t i) {
+        bus.publish(Tick{i, 0.016});
+        bench::clobber();
+    }));
+    bench::report("std::vector<delegate>", bench::ns_per_op(iterations, [&](std::size_t i) {
+        for (const auto& handler : delegates) {
+            handler(Tick{i, 0.016});
+        }
+        bench::clobber();
+    }));
+    bench::report("std::vector<std::function>", bench::ns_per_op(iterations, [&](std::size_t i) {
+        for (const auto& handler : functions) {
+            handler(Tick{i, 0.016});
+        }
+        bench::clobber();
+    }));
+    bench::report("std::function bus keyed by type_index", bench::ns_per_op(iterations, [&](std::size_t i) {
+        erased.publish(Tick{i, 0.016});
+        bench::clobber();
+    }));
+
+    bench::do_not_optimize(physics.time + audio.clock + animation.frames + ticks);
+    return 0;
+}
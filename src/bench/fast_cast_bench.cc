@@ -0,0 +1,88 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "fast_cast.h"
+#include "bench.h"
+
+using namespace hierarchy;
+
+/*Deep : a single chain Deep<0> <- Deep<1> <- ... <- Deep<Depth - 1>*/
+constexpr int Depth = 16;
+
+template<int I>
+struct Deep : hierarchy_node<Deep<I>, Deep<I - 1>> { };
+
+template<>
+struct Deep<0> : hierarchy_root<Deep<0>> {
+    virtual ~Deep() = default;
+};
+
+template<typename Sequence>
+struct deep_hierarchy;
+
+template<std::size_t... Is>
+struct deep_hierarchy<std::index_sequence<Is...>> {
+    using type = class_hierarchy<Deep<static_cast<int>(Is)>...>;
+};
+
+template<>
+struct hierarchy::class_hierarchy_of<Deep<0>> : deep_hierarchy<std::make_index_sequence<Depth>> { };
+
+/*Wide : Wide<0> with Width - 1 direct children*/
+constexpr int Width = 32;
+
+template<int I>
+struct Wide : hierarchy_node<Wide<I>, Wide<0>> { };
+
+template<>
+struct Wide<0> : hierarchy_root<Wide<0>> {
+    virtual ~Wide() = default;
+};
+
+template<typename Sequence>
+struct wide_hierarchy;
+
+template<std::size_t... Is>
+struct wide_hierarchy<std::index_sequence<Is...>> {
+    using type = class_hierarchy<Wide<static_cast<int>(Is)>...>;
+};
+
+template<>
+struct hierarchy::class_hierarchy_of<Wide<0>> : wide_hierarchy<std::make_index_sequence<Width>> { };
+
+
+template<typename Root, template<int> class Family, int... Is>
+std::vector<std::unique_ptr<Root>> make_family(std::integer_sequence<int, Is...>) {
+    std::vector<std::unique_ptr<Root>> objects;
+    (objects.emplace_back(std::make_unique<Family<Is>>()), ...);
+    return objects;
+}
+
+template<typename Target, typename Root>
+void run(const char* title, const std::vector<std::unique_ptr<Root>>& objects) {
+    constexpr std::size_t iterations = 1 << 22;
+    std::vector<Root*> pointers;
+    for (std::size_t i = 0; i < 1024; ++i) {
+        pointers.push_back(objects[(i * 7) % objects.size()].get());
+    }
+
+    std::printf("%s\n", title);
+    bench::report("dynamic_cast", bench::ns_per_op(iterations, [&](std::size_t i) {
+        bench::do_not_optimize(dynamic_cast<Target*>(pointers[i & 1023]));
+    }));
+    bench::report("fast_cast", bench::ns_per_op(iterations, [&](std::size_t i) {
+        bench::do_not_optimize(fast_cast<Target>(pointers[i & 1023]));
+    }));
+}
+
+int main() {
+    auto deep = make_family<Deep<0>, Deep>(std::make_integer_sequence<int, Depth>{});
+    auto wide = make_family<Wide<0>, Wide>(std::make_integer_sequence<int, Width>{});
+
+    run<Deep<1>>("deep hierarchy, cast to a shallow class (mostly hits)", deep);
+    run<Deep<Depth - 2>>("deep hierarchy, cast to a deep class (mostly misses)", deep);
+    run<Wide<Width / 2>>("wide hierarchy, cast to one leaf", wide);
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "hashing.h"
+#include "bench.h"
+
+using namespace hashing;
+
+/*Composite hash-join keys*/
+struct Key16 {
+    std::uint64_t order;
+    std::uint32_t customer;
+    std::uint32_t region;
+};
+
+struct Key64 {
+    std::uint64_t fields[8];
+};
+
+template<typename T>
+std::uint64_t field_by_field(const T& key);
+
+template<>
+std::uint64_t field_by_field(const Key16& key) {
+    std::uint64_t h = std::hash<std::uint64_t>{}(key.order);
+    h = hash_combine(h, std::hash<std::uint32_t>{}(key.customer));
+    return hash_combine(h, std::hash<std::uint32_t>{}(key.region));
+}
+
+template<>
+std::uint64_t field_by_field(const Key64& key) {
+    std::uint64_t h = 0;
+    for (std::uint64_t field : key.fields) {
+        h = hash_combine(h, std::hash<std::uint64_t>{}(field));
+    }
+    return h;
+}
+
+template<typename T>
+void run(const char* title) {
+    constexpr std::size_t count = 1 << 16;
+    std::vector<T> keys(count);
+    std::uint64_t state = 1;
+    for (auto& key : keys) {
+        for (std::size_t i = 0; i < sizeof(T); i += 8) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            std::memcpy(reinterpret_cast<unsigned char*>(&key) + i, &state, 8);
+        }
+    }
+
+    std::printf("%s (%zu bytes), ns per key\n", title, sizeof(T));
+    std::string bytes = std::string(title) + ", hash_value (unique representation)";
+    std::string fields = std::string(title) + ", field by field";
+    bench::run(bytes.c_str(), count * 16, [&](std::size_t i) {
+        bench::do_not_optimize(hash_value(keys[i & (count - 1)]));
+    });
+    bench::run(fields.c_str(), count * 16, [&](std::size_t i) {
+        bench::do_not_optimize(field_by_field(keys[i & (count - 1)]));
+    });
+}
+
+int main() {
+    run<Key16>("join key");
+    run<Key64>("wide join key");
+
+    std::vector<unsigned char> buffer(1 << 16, 0x5a);
+    for (std::size_t size : {256u, 4096u, 65536u}) {
+        std::string name = "hash_bytes, " + std::to_string(size) + " bytes";
+        double ns = bench::run(name.c_str(), (std::size_t(1) << 26) / size, [&](std::size_t i) {
+            bench::do_not_optimize(hash_bytes(buffer.data(), size, i));
+        });
+        std::printf("%-48s %10.2f GB/s\n", "", size / ns);
+    }
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "object_pool.h"
+#include "bench.h"
+
+using namespace containers;
+
+/*Trivial : the pool reuses it without constructor or destructor*/
+struct Request {
+    std::uint64_t id;
+    std::uint32_t bytes;
+    std::uint32_t flags;
+    char path[48];
+};
+
+/*Non-trivial : destroyed and rebuilt, with a heap-allocated peer name beyond SSO*/
+struct Connection {
+    explicit Connection(std::uint64_t id) : id(id), peer("connection-peer-name-long-enough-for-heap") { }
+
+    std::uint64_t id;
+    std::string peer;
+    std::vector<std::uint32_t> pending;
+};
+
+/*Churn : keep `window` objects alive, replace the oldest on every step*/
+template<typename T, typename Create, typename Destroy>
+void churn(const char* name, Create create, Destroy destroy) {
+    constexpr std::size_t window = 256;
+    constexpr std::size_t steps = 1 << 20;
+    std::vector<T*> live(window, nullptr);
+    for (std::size_t i = 0; i < window; ++i) {
+        live[i] = create(i);
+    }
+    bench::run(name, steps, [&](std::size_t i) {
+        T*& slot = live[i % window];
+        destroy(slot);
+        slot = create(i);
+        bench::do_not_optimize(slot);
+    });
+    for (T* object : live) {
+        destroy(object);
+    }
+}
+
+template<typename T, typename Create, typename Destroy>
+void churn_threads(const char* name, int threads_count, Create create, Destroy destroy) {
+    constexpr std::size_t window = 256;
+    constexpr std::size_t steps = 1 << 20;
+    std::uint64_t start = instrumentation::wall_ns();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t) {
+        threads.emplace_back([&] {
+            std::vector<T*> live(window, nullptr);
+            for (std::size_t i = 0; i < window; ++i) {
+                live[i] = create(i);
+            }
+            for (std::size_t i = 0; i < steps; ++i) {
+                T*& slot = live[i % window];
+                destroy(slot);
+                slot = create(i);
+                bench::do_not_optimize(slot);
+            }
+            for (T* object : live) {
+                destroy(object);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double ns = static_cast<double>(instrumentation::wall_ns() - start) / steps;
+    bench::report(name, ns);
+}
+
+int main() {
+    object_pool<Request> requests;
+    object_pool<Connection> connections;
+
+    churn<Request>("Request, object_pool",
+                   [&](std::size_t i) { return requests.create(Request{i, 0, 0, {}}); },
+                   [&](Request* r) { requests.destroy(r); });
+    churn<Request>("Request, object_pool default-initialized",
+                   [&](std::size_t) { return requests.create(); },
+                   [&](Request* r) { requests.destroy(r); });
+    churn<Request>("Request, make_unique",
+                   [](std::size_t i) { return std::make_unique<Request>(Request{i, 0, 0, {}}).release(); },
+                   [](Request* r) { std::unique_ptr<Request>{r}; });
+    churn<Connection>("Connection, object_pool",
+                      [&](std::size_t i) { return connections.create(i); },
+                      [&](Connection* c) { connections.destroy(c); });
+    churn<Connection>("Connection, make_unique",
+                      [](std::size_t i) { return std::make_unique<Connection>(i).release(); },
+                      [](Connection* c) { std::unique_ptr<Connection>{c}; });
+
+    /*Wall time per step of one thread, all threads churning at once*/
+    for (int threads : {2, 4}) {
+        std::string pooled = "Request, object_pool, " + std::to_string(threads) + " threads";
+        std::string heap = "Request, make_unique, " + std::to_string(threads) + " threads";
+        churn_threads<Request>(pooled.c_str(), threads,
+                               [&](std::size_t i) { return requests.create(Request{i, 0, 0, {}}); },
+                               [&](Request* r) { requests.destroy(r); });
+        churn_threads<Request>(heap.c_str(), threads,
+                               [](std::size_t i) { return std::make_unique<Request>(Request{i, 0, 0, {}}).release(); },
+                               [](Request* r) { std::unique_ptr<Request>{r}; });
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+#include <cstdint>
+#include <vector>
+
+#include "packed_int_array.h"
+#include "bench.h"
+
+using namespace containers;
+
+template<std::size_t Bits>
+void run() {
+    constexpr std::size_t count = 1 << 22;
+    constexpr std::size_t chunk = 256;
+
+    packed_int_array<Bits> packed(count);
+    std::vector<std::uint32_t> plain(count);
+    std::uint64_t state = 7;
+    for (std::size_t i = 0; i < count; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        auto value = static_cast<typename packed_int_array<Bits>::value_type>((state >> 33) & packed_int_array<Bits>::max_value);
+        packed.set(i, value);
+        plain[i] = value;
+    }
+
+    std::printf("%zu-bit codes, %zu values\n", Bits, count);
+    std::printf("  memory: packed %.2f MiB, std::vector<uint32_t> %.2f MiB\n",
+                packed.memory_bytes() / 1048576.0, plain.size() * sizeof(std::uint32_t) / 1048576.0);
+
+    bench::report("  scan std::vector<uint32_t>", bench::ns_per_op(1, [&](std::size_t) {
+        std::uint64_t total = 0;
+        for (std::uint32_t value : plain) {
+            total += value;
+        }
+        bench::do_not_optimize(total);
+    }) / count);
+    bench::report("  scan packed, unpack 256 at a time", bench::ns_per_op(1, [&](std::size_t) {
+        typename packed_int_array<Bits>::value_type buffer[chunk];
+        std::uint64_t total = 0;
+        for (std::size_t first = 0; first < count; first += chunk) {
+            packed.unpack(first, chunk, buffer);
+            for (auto value : buffer) {
+                total += value;
+            }
+        }
+        bench::do_not_optimize(total);
+    }) / count);
+    bench::report("  scan packed, get() per value", bench::ns_per_op(1, [&](std::size_t) {
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            total += packed.get(i);
+        }
+        bench::do_not_optimize(total);
+    }) / count);
+}
+
+int main() {
+    run<10>();
+    run<17>();
+    run<20>();
+    return 0;
+}
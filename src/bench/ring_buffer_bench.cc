@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ring_buffer.h"
+#include "bench.h"
+
+using namespace concurrency;
+
+/*Non-trivial payload : goes through placement-new and destroy*/
+struct Message {
+    std::uint64_t stamp = 0;
+    std::string body;
+};
+
+inline std::uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline std::uint64_t make_payload(std::uint64_t stamp, std::uint64_t*) { return stamp; }
+inline Message make_payload(std::uint64_t stamp, Message*) { return Message{stamp, "order"}; }
+inline std::uint64_t stamp_of(const std::uint64_t& payload) { return payload; }
+inline std::uint64_t stamp_of(const Message& payload) { return payload.stamp; }
+
+template<typename Queue, typename T>
+void run(const char* name, int producers, int consumers) {
+    constexpr std::uint64_t messages = 1 << 20;
+    Queue queue;
+    std::atomic<std::uint64_t> consumed{0};
+    std::vector<std::vector<std::uint64_t>> latencies(consumers);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            std::uint64_t count = messages / producers + (p < static_cast<int>(messages % producers));
+            for (std::uint64_t i = 0; i < count; ++i) {
+                T payload = make_payload(now_ns(), static_cast<T*>(nullptr));
+                while (!queue.try_push(std::move(payload))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c] {
+            latencies[c].reserve(messages);
+            T payload{};
+            while (consumed.load(std::memory_order_relaxed) < messages) {
+                if (queue.try_pop(payload)) {
+                    latencies[c].push_back(now_ns() - stamp_of(payload));
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<std::uint64_t> all;
+    for (auto& samples : latencies) {
+        all.insert(all.end(), samples.begin(), samples.end());
+    }
+    std::sort(all.begin(), all.end());
+    auto percentile = [&all](double p) { return all[static_cast<std::size_t>(p * (all.size() - 1))]; };
+
+    std::string label = std::string(name) + ", " + std::to_string(producers) + "P:" + std::to_string(consumers) + "C";
+    bench::report(label.c_str(), seconds * 1e9 / messages);
+    std::printf("%-48s latency p50 %llu ns, p99 %llu ns, p99.9 %llu ns\n", "",
+                static_cast<unsigned long long>(percentile(0.5)),
+                static_cast<unsigned long long>(percentile(0.99)),
+                static_cast<unsigned long long>(percentile(0.999)));
+}
+
+int main() {
+    constexpr std::size_t capacity = 1024;
+
+    std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+    run<spsc_ring_buffer<std::uint64_t, capacity>, std::uint64_t>("spsc inline u64", 1, 1);
+    run<spsc_ring_buffer<Message, capacity>, Message>("spsc constructed Message", 1, 1);
+
+    const int shapes[][2] = {{1, 1}, {2, 2}, {4, 4}, {1, 4}, {4, 1}};
+    for (const auto& shape : shapes) {
+        run<mpmc_ring_buffer<std::uint64_t, capacity>, std::uint64_t>("mpmc inline u64", shape[0], shape[1]);
+    }
+    for (const auto& shape : shapes) {
+        run<mpmc_ring_buffer<Message, capacity>, Message>("mpmc constructed Message", shape[0], shape[1]);
+    }
+    return 0;
+}
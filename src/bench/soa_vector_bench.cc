@@ -0,0 +1,74 @@
+#include <cstdint>
+#include <vector>
+
+#include "soa_vector.h"
+#include "bench.h"
+
+using namespace containers;
+
+/*56 bytes per record, the scans below read 8 of them*/
+struct Record {
+    std::uint64_t id;
+    double price;
+    std::uint32_t quantity;
+    std::uint32_t flags;
+    std::uint64_t timestamp;
+    std::uint64_t owner;
+    double fee;
+    std::uint64_t venue;
+};
+
+int main() {
+    constexpr std::size_t count = 1 << 20;
+
+    std::vector<Record> aos;
+    soa_vector<Record> soa;
+    aos.reserve(count);
+    soa.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        Record record{i, 1.0 + (i % 100) * 0.25, static_cast<std::uint32_t>(i % 7), 0, i * 3, i % 13, 0.01, i % 5};
+        aos.push_back(record);
+        soa.push_back(record);
+    }
+
+    std::printf("%zu records of %zu bytes, ns per record\n", count, sizeof(Record));
+
+    bench::report("scan price: std::vector<Record>", bench::ns_per_op(1, [&](std::size_t) {
+        double total = 0;
+        for (const Record& record : aos) {
+            total += record.price;
+        }
+        bench::do_not_optimize(total);
+    }) / count);
+    bench::report("scan price: soa_vector column", bench::ns_per_op(1, [&](std::size_t) {
+        double total = 0;
+        for (double price : soa.column<1>()) {
+            total += price;
+        }
+        bench::do_not_optimize(total);
+    }) / count);
+    bench::report("scan price: soa_vector proxies", bench::ns_per_op(1, [&](std::size_t) {
+        double total = 0;
+        for (auto record : soa) {
+            total += record.get<1>();
+        }
+        bench::do_not_optimize(total);
+    }) / count);
+
+    bench::report("update price*qty: std::vector<Record>", bench::ns_per_op(1, [&](std::size_t) {
+        for (Record& record : aos) {
+            record.price *= 1.0 + record.quantity * 0.001;
+        }
+        bench::clobber();
+    }) / count);
+    bench::report("update price*qty: soa_vector columns", bench::ns_per_op(1, [&](std::size_t) {
+        std::vector<double>& prices = soa.column<1>();
+        const std::vector<std::uint32_t>& quantities = soa.column<2>();
+        for (std::size_t i = 0; i < prices.size(); ++i) {
+            prices[i] *= 1.0 + quantities[i] * 0.001;
+        }
+        bench::clobber();
+    }) / count);
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "static_map.h"
+#include "bench.h"
+
+using namespace containers;
+
+/*Sparse opcode space, as in a bytecode or wire protocol decoder*/
+constexpr auto opcodes = make_static_map<std::uint32_t, int>({
+    {0x0001u, 1}, {0x0003u, 2}, {0x0010u, 3}, {0x0011u, 4}, {0x0020u, 5}, {0x002fu, 6},
+    {0x0100u, 7}, {0x0101u, 8}, {0x0180u, 9}, {0x0200u, 10}, {0x0333u, 11}, {0x0400u, 12},
+    {0x0801u, 13}, {0x0fffu, 14}, {0x1000u, 15}, {0x1001u, 16}, {0x2000u, 17}, {0x4242u, 18},
+    {0x8000u, 19}, {0x8001u, 20}, {0x9000u, 21}, {0xa0a0u, 22}, {0xbeefu, 23}, {0xcafeu, 24},
+    {0xd000u, 25}, {0xe001u, 26}, {0xf00du, 27}, {0xfeedu, 28}, {0xff00u, 29}, {0xfff0u, 30},
+    {0xfffeu, 31}, {0xffffu, 32}});
+
+constexpr auto config = make_static_map<std::string_view, int>({
+    {"threads", 1}, {"timeout_ms", 2}, {"log_level", 3}, {"listen_address", 4},
+    {"listen_port", 5}, {"max_connections", 6}, {"keepalive", 7}, {"tls_certificate", 8},
+    {"tls_private_key", 9}, {"cache_size_mb", 10}, {"compression", 11}, {"metrics_endpoint", 12},
+    {"read_buffer_bytes", 13}, {"write_buffer_bytes", 14}, {"retry_limit", 15}, {"backoff_ms", 16}});
+
+template<typename Key, std::size_t N>
+void run(const char* title, const static_map<Key, int, N>& map, const std::vector<Key>& keys) {
+    constexpr std::size_t iterations = 1 << 22;
+    const std::size_t n = keys.size();
+
+    std::unordered_map<Key, int> hashed(map.begin(), map.end());
+
+    std::array<std::pair<Key, int>, N> sorted{};
+    std::copy(map.begin(), map.end(), sorted.begin());
+    std::sort(sorted.begin(), sorted.end());
+
+    std::printf("%s (%zu keys)\n", title, map.size());
+    bench::report("static_map", bench::ns_per_op(iterations, [&](std::size_t i) {
+        bench::do_not_optimize(map.find(keys[i % n]));
+    }));
+    bench::report("std::unordered_map", bench::ns_per_op(iterations, [&](std::size_t i) {
+        auto it = hashed.find(keys[i % n]);
+        bench::do_not_optimize(it == hashed.end() ? 0 : it->second);
+    }));
+    bench::report("sorted std::array + binary search", bench::ns_per_op(iterations, [&](std::size_t i) {
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), keys[i % n],
+                                   [](const auto& entry, const Key& key) { return entry.first < key; });
+        bench::do_not_optimize(it != sorted.end() && it->first == keys[i % n] ? it->second : 0);
+    }));
+}
+
+int main() {
+    /*Every key once plus a few misses, shuffled so the branch predictor cannot learn the order*/
+    std::vector<std::uint32_t> integral_keys;
+    for (const auto& entry : opcodes) {
+        integral_keys.push_back(entry.first);
+    }
+    integral_keys.insert(integral_keys.end(), {0x0002u, 0x7777u, 0xabcdu});
+
+    std::vector<std::string_view> string_keys;
+    for (const auto& entry : config) {
+        string_keys.push_back(entry.first);
+    }
+    string_keys.insert(string_keys.end(), {"thread", "listen_portx", "unknown_option"});
+
+    std::uint64_t seed = 42;
+    auto shuffle = [&seed](auto& keys) {
+        for (std::size_t i = keys.size(); i > 1; --i) {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            std::swap(keys[i - 1], keys[(seed >> 33) % i]);
+        }
+    };
+    shuffle(integral_keys);
+    shuffle(string_keys);
+
+    run("integral keys", opcodes, integral_keys);
+    run("string keys", config, string_keys);
+
+    return 0;
+}
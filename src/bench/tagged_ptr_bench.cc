@@ -0,0 +1,134 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tagged_ptr.h"
+#include "bench.h"
+
+using namespace concurrency;
+
+/*List node keeping a separate state byte next to its link*/
+struct FlaggedNode {
+    std::uint64_t value;
+    FlaggedNode* next;
+    std::uint8_t state;
+};
+
+/*Same node, the state lives in the link's spare bits*/
+struct TaggedNode {
+    std::uint64_t value;
+    tagged_ptr<TaggedNode, 3> next;
+};
+
+/*
+ * Treiber stack over recycled nodes : a node popped and pushed back while another
+ * thread sits between load and compare_exchange is exactly the ABA case the tag catches.
+ */
+class tagged_stack {
+    public:
+        struct alignas(16) node {
+            std::atomic<node*> next{nullptr};
+            std::uint64_t value = 0;
+        };
+
+        void push(node* item) noexcept {
+            tagged_ptr<node, 4> expected = head_.load(std::memory_order_relaxed);
+            do {
+                item->next.store(expected.get(), std::memory_order_relaxed);
+            } while (!head_.compare_exchange_weak(expected, expected.next_tag(item),
+                                                  std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        node* pop() noexcept {
+            tagged_ptr<node, 4> expected = head_.load(std::memory_order_acquire);
+            while (expected) {
+                node* next = expected->next.load(std::memory_order_relaxed);
+                if (head_.compare_exchange_weak(expected, expected.next_tag(next),
+                                                std::memory_order_acquire, std::memory_order_acquire)) {
+                    return expected.get();
+                }
+            }
+            return nullptr;
+        }
+
+    private:
+        alignas(64) atomic_tagged_ptr<tagged_stack::node, 4> head_;
+};
+
+class mutex_stack {
+    public:
+        using node = tagged_stack::node;
+
+        void push(node* item) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            items_.push_back(item);
+        }
+
+        node* pop() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (items_.empty()) {
+                return nullptr;
+            }
+            node* item = items_.back();
+            items_.pop_back();
+            return item;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::vector<node*> items_;
+};
+
+template<typename Stack>
+void run(const char* name, int thread_count) {
+    constexpr std::size_t operations = 1 << 21;
+    constexpr std::size_t nodes_per_thread = 64;
+
+    Stack stack;
+    std::vector<tagged_stack::node> nodes(nodes_per_thread * thread_count);
+    for (auto& item : nodes) {
+        stack.push(&item);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&stack] {
+            for (std::size_t i = 0; i < operations / 2; ++i) {
+                tagged_stack::node* item = stack.pop();
+                if (item != nullptr) {
+                    ++item->value;
+                    stack.push(item);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    std::uint64_t touched = 0;
+    for (auto& item : nodes) {
+        touched += item.value;
+    }
+    bench::do_not_optimize(touched);
+    std::string label = std::string(name) + ", " + std::to_string(thread_count) + " threads";
+    bench::report(label.c_str(), ns / (operations * thread_count));
+}
+
+int main() {
+    std::printf("node with state byte : %zu bytes\n", sizeof(FlaggedNode));
+    std::printf("node with tagged link: %zu bytes\n", sizeof(TaggedNode));
+    std::printf("one million nodes   : %zu vs %zu MiB\n", sizeof(FlaggedNode) * 1000000 >> 20, sizeof(TaggedNode) * 1000000 >> 20);
+
+    for (int threads : {1, 2, 4}) {
+        run<tagged_stack>("lock-free stack, tagged head", threads);
+        run<mutex_stack>("std::mutex + std::vector stack", threads);
+    }
+    return 0;
+}
@@ -0,0 +1,86 @@
+/*
+ * Compile-time benchmark : never run, only compiled with -fsyntax-only by the
+ * transformations_compile_bench target, once per value of TRAITS :
+ *     0   generates the types only, the baseline to subtract
+ *     1   applies the type_trait.h transformations
+ *     2   applies the <type_traits> ones
+ * Types are rank 1..max_rank arrays and pointers nested 1..max_depth deep, each cv-qualified,
+ * over seeds distinct integral_constant element types so nothing is shared between them.
+ */
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "type_trait.h"
+
+#ifndef TRAITS
+#define TRAITS 1
+#endif
+
+namespace compile_bench {
+    constexpr std::size_t seeds = 16;
+    constexpr std::size_t max_rank = 64;
+    constexpr std::size_t max_depth = 64;
+
+    template<std::size_t Seed>
+    using element = std::integral_constant<std::size_t, Seed>;
+
+    /*element[1][1]...[1], Rank extents*/
+    template<typename T, std::size_t Rank>
+    struct make_array {
+        using type = typename make_array<T, Rank - 1>::type[1];
+    };
+
+    template<typename T>
+    struct make_array<T, 0> {
+        using type = T;
+    };
+
+    /*element* const* const ... * const, Depth pointers*/
+    template<typename T, std::size_t Depth>
+    struct make_pointer {
+        using type = typename make_pointer<T, Depth - 1>::type* const;
+    };
+
+    template<typename T>
+    struct make_pointer<T, 0> {
+        using type = T;
+    };
+
+    template<typename T>
+    constexpr bool transform() {
+#if TRAITS == 1
+        using namespace remove_const_volatile;
+        using namespace references;
+        using namespace pointers;
+        using namespace arrays;
+        using namespace miscellaneous_transformation;
+
+        using type = decltype(sizeof(remove_all_extents_t<T>), sizeof(remove_cv_t<T>), sizeof(decay_t<T const&>),
+                              sizeof(remove_cvref_t<T const volatile&>), sizeof(add_pointer_t<T&>),
+                              sizeof(add_lvalue_reference_t<T>), sizeof(add_rvalue_reference_t<T>));
+#elif TRAITS == 2
+        using type = decltype(sizeof(std::remove_all_extents_t<T>), sizeof(std::remove_cv_t<T>),
+                              sizeof(std::decay_t<T const&>), sizeof(std::remove_cv_t<std::remove_reference_t<T const volatile&>>),
+                              sizeof(std::add_pointer_t<T&>), sizeof(std::add_lvalue_reference_t<T>),
+                              sizeof(std::add_rvalue_reference_t<T>));
+#else
+        using type = decltype(sizeof(T));
+#endif
+        return sizeof(type) != 0;
+    }
+
+    template<std::size_t Seed, std::size_t... Ns>
+    constexpr bool transform_seed(std::index_sequence<Ns...>) {
+        return (transform<typename make_array<element<Seed>, Ns + 1>::type>() && ...) &&
+               (transform<typename make_pointer<element<Seed>, Ns + 1>::type>() && ...);
+    }
+
+    template<std::size_t... Seeds>
+    constexpr bool transform_all(std::index_sequence<Seeds...>) {
+        static_assert(max_rank == max_depth, "one index sequence drives both the ranks and the depths");
+        return (transform_seed<Seeds>(std::make_index_sequence<max_rank>{}) && ...);
+    }
+
+    static_assert(transform_all(std::make_index_sequence<seeds>{}), "every transformation must be well-formed");
+}
@@ -0,0 +1,150 @@
+#ifndef INCLUDE_ALGORITHMS_H
+#define INCLUDE_ALGORITHMS_H
+
+#include <cstddef>
+#include <cstring>
+
+#include "type_trait.h"
+
+/*equal, compare, fill and copy lowered to memcmp, memset and memmove when the traits allow*/
+namespace algorithms {
+    using namespace type_properties;
+    using namespace pointers;
+    using namespace supported_operations;
+
+    namespace detail {
+        template<typename It>
+        using pointee_t = remove_cv_t<remove_pointer_t<It>>;
+    }
+
+    /*memset writes one byte value : byte-sized integral elements only*/
+    template<typename It, typename T, bool = is_pointer_v<It>>
+    struct is_memset_fillable : public false_type { };
+
+    template<typename It, typename T>
+    struct is_memset_fillable<It, T, true> : public bool_constant<
+                                                   !is_const_v<remove_pointer_t<It>> &&
+                                                   is_integral_v<detail::pointee_t<It>> &&
+                                                   sizeof(detail::pointee_t<It>) == 1 &&
+                                                   is_integral_v<remove_cv_t<T>>> { };
+
+    template<typename It, typename T>
+    inline constexpr bool is_memset_fillable_v = is_memset_fillable<It, T>::value;
+
+    /*Byte copies only where the element loop would compile and be a plain copy : const members rule it out*/
+    template<typename InputIt, typename OutputIt, bool = is_pointer_v<InputIt> && is_pointer_v<OutputIt>>
+    struct is_memmove_copyable : public false_type { };
+
+    template<typename InputIt, typename OutputIt>
+    struct is_memmove_copyable<InputIt, OutputIt, true> : public bool_constant<
+                                                                 is_same_v<detail::pointee_t<InputIt>, remove_pointer_t<OutputIt>> &&
+                                                                 is_trivially_copyable_v<detail::pointee_t<InputIt>> &&
+                                                                 is_trivially_assignable_v<remove_pointer_t<OutputIt>&,
+                                                                                           const detail::pointee_t<InputIt>&>> { };
+
+    template<typename InputIt, typename OutputIt>
+    inline constexpr bool is_memmove_copyable_v = is_memmove_copyable<InputIt, OutputIt>::value;
+
+    /*
+     * Equal bytes must mean equal values : scalars with a unique object representation.
+     * Note : class types are left out, their operator== may compare less than every byte.
+     */
+    template<typename It1, typename It2, bool = is_pointer_v<It1> && is_pointer_v<It2>>
+    struct is_memcmp_equality_comparable : public false_type { };
+
+    template<typename It1, typename It2>
+    struct is_memcmp_equality_comparable<It1, It2, true> : public bool_constant<
+                                                                  is_same_v<detail::pointee_t<It1>, detail::pointee_t<It2>> &&
+                                                                  is_scalar_v<detail::pointee_t<It1>> &&
+                                                                  has_unique_object_representations_v<detail::pointee_t<It1>>> { };
+
+    template<typename It1, typename It2>
+    inline constexpr bool is_memcmp_equality_comparable_v = is_memcmp_equality_comparable<It1, It2>::value;
+
+    /*memcmp orders as unsigned char : only byte-sized unsigned elements keep their order*/
+    template<typename It1, typename It2, bool = is_pointer_v<It1> && is_pointer_v<It2>>
+    struct is_memcmp_ordered : public false_type { };
+
+    template<typename It1, typename It2>
+    struct is_memcmp_ordered<It1, It2, true> : public bool_constant<
+                                                      is_same_v<detail::pointee_t<It1>, detail::pointee_t<It2>> &&
+                                                      is_unsigned_v<detail::pointee_t<It1>> &&
+                                                      sizeof(detail::pointee_t<It1>) == 1> { };
+
+    template<typename It1, typename It2>
+    inline constexpr bool is_memcmp_ordered_v = is_memcmp_ordered<It1, It2>::value;
+
+    template<typename It, typename T>
+    void fill(It first, It last, const T& value) {
+        if constexpr (is_memset_fillable_v<It, T>) {
+            if (first != last) {
+                /*Through the element type first : bool turns 2 or 256 into true, not into byte 2 or 0*/
+                std::memset(first, static_cast<unsigned char>(static_cast<detail::pointee_t<It>>(value)),
+                            static_cast<std::size_t>(last - first));
+            }
+        } else {
+            for (; first != last; ++first) {
+                *first = value;
+            }
+        }
+    }
+
+    /*Overlapping ranges are allowed as for std::copy, hence memmove and not memcpy*/
+    template<typename InputIt, typename OutputIt>
+    OutputIt copy(InputIt first, InputIt last, OutputIt out) {
+        if constexpr (is_memmove_copyable_v<InputIt, OutputIt>) {
+            std::size_t count = static_cast<std::size_t>(last - first);
+            if (count != 0) {
+                std::memmove(out, first, count * sizeof(*first));
+            }
+            return out + count;
+        } else {
+            for (; first != last; ++first, ++out) {
+                *out = *first;
+            }
+            return out;
+        }
+    }
+
+    template<typename It1, typename It2>
+    bool equal(It1 first1, It1 last1, It2 first2) {
+        if constexpr (is_memcmp_equality_comparable_v<It1, It2>) {
+            std::size_t count = static_cast<std::size_t>(last1 - first1);
+            return count == 0 || std::memcmp(first1, first2, count * sizeof(*first1)) == 0;
+        } else {
+            for (; first1 != last1; ++first1, ++first2) {
+                if (!(*first1 == *first2)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    /*Lexicographic three-way compare : negative, zero or positive*/
+    template<typename It1, typename It2>
+    int compare(It1 first1, It1 last1, It2 first2, It2 last2) {
+        if constexpr (is_memcmp_ordered_v<It1, It2>) {
+            std::size_t count1 = static_cast<std::size_t>(last1 - first1);
+            std::size_t count2 = static_cast<std::size_t>(last2 - first2);
+            std::size_t count = count1 < count2 ? count1 : count2;
+            int result = count == 0 ? 0 : std::memcmp(first1, first2, count);
+            if (result != 0) {
+                return result;
+            }
+            return count1 < count2 ? -1 : (count1 > count2 ? 1 : 0);
+        } else {
+            for (; first1 != last1 && first2 != last2; ++first1, ++first2) {
+                if (*first1 < *first2) {
+                    return -1;
+                }
+                if (*first2 < *first1) {
+                    return 1;
+                }
+            }
+            return first1 != last1 ? 1 : (first2 != last2 ? -1 : 0);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef INCLUDE_ATOMIC_STORAGE_H
+#define INCLUDE_ATOMIC_STORAGE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+#include "type_trait.h"
+
+/*Shared-memory building blocks selected by type traits*/
+namespace concurrency {
+    using namespace type_properties;
+    using namespace miscellaneous_transformation;
+
+    inline constexpr std::size_t cache_line_size = 64;
+
+    inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield" ::: "memory");
+#endif
+    }
+
+    /*std::atomic<T> may only be named once T is known to be trivially copyable*/
+    template<typename T, bool = is_trivially_copyable_v<T>>
+    struct is_lock_free_storable_helper : public bool_constant<
+                                                sizeof(T) <= 2 * sizeof(void*) &&
+                                                std::atomic<T>::is_always_lock_free> { };
+
+    template<typename T>
+    struct is_lock_free_storable_helper<T, false> : public false_type { };
+
+    template<typename T>
+    struct is_lock_free_storable : public is_lock_free_storable_helper<T> { };
+
+    template<typename T>
+    inline constexpr bool is_lock_free_storable_v = is_lock_free_storable<T>::value;
+
+    template<typename T>
+    class atomic_cell {
+        public:
+            static constexpr bool is_lock_free = true;
+
+            explicit atomic_cell(const T& value = T{}) noexcept : value_(value) { }
+
+            T load() const noexcept {
+                return value_.load(std::memory_order_acquire);
+            }
+
+            void store(const T& value) noexcept {
+                value_.store(value, std::memory_order_release);
+            }
+
+        private:
+            alignas(cache_line_size) std::atomic<T> value_;
+    };
+
+    /*
+     * Sequence lock : writers make the sequence odd while copying in, readers
+     * copy out optimistically and retry when the sequence moved underneath them.
+     * The payload is kept in relaxed atomic words, so a torn read is a retry and not a data race.
+     */
+    template<typename T>
+    class seqlock_cell {
+        public:
+            static constexpr bool is_lock_free = false;
+
+            explicit seqlock_cell(const T& value = T{}) noexcept {
+                write_words(value);
+            }
+
+            T load() const noexcept {
+                std::uint64_t buffer[word_count];
+                for (;;) {
+                    std::uint64_t before = sequence_.load(std::memory_order_acquire);
+                    if (before & 1) {
+                        cpu_relax();
+                        continue;
+                    }
+                    for (std::size_t i = 0; i < word_count; ++i) {
+                        buffer[i] = words_[i].load(std::memory_order_relaxed);
+                    }
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (sequence_.load(std::memory_order_relaxed) == before) {
+                        break;
+                    }
+                }
+
+                alignas(T) unsigned char raw[sizeof(T)];
+                std::memcpy(raw, buffer, sizeof(T));
+                return *std::launder(reinterpret_cast<T*>(raw));
+            }
+
+            /*Writers exclude each other : the acquiring CAS pairs with the release that ends the previous write*/
+            void store(const T& value) noexcept {
+                std::uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+                for (;;) {
+                    if (!(sequence & 1) &&
+                        sequence_.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire,
+                                                        std::memory_order_relaxed)) {
+                        break;
+                    }
+                    cpu_relax();
+                    sequence = sequence_.load(std::memory_order_relaxed);
+                }
+                std::atomic_thread_fence(std::memory_order_release);
+                write_words(value);
+                sequence_.store(sequence + 2, std::memory_order_release);
+            }
+
+        private:
+            static constexpr std::size_t word_count = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+            void write_words(const T& value) noexcept {
+                std::uint64_t buffer[word_count] = {};
+                std::memcpy(buffer, &value, sizeof(T));
+                for (std::size_t i = 0; i < word_count; ++i) {
+                    words_[i].store(buffer[i], std::memory_order_relaxed);
+                }
+            }
+
+            alignas(cache_line_size) std::atomic<std::uint64_t> sequence_{0};
+            std::atomic<std::uint64_t> words_[word_count];
+    };
+
+    /*
+     * Snapshot cell read by many threads : a plain std::atomic when T fits a
+     * lock-free atomic, a seqlock otherwise.
+     * Note : both need is_trivially_copyable, a seqlock reader copies bytes that may be torn.
+     */
+    template<typename T>
+    struct atomic_storage_selector {
+        static_assert(is_trivially_copyable_v<T>, "atomic_storage needs a trivially copyable type");
+
+        using type = conditional_t<is_lock_free_storable_v<T>, atomic_cell<T>, seqlock_cell<T>>;
+    };
+
+    template<typename T>
+    using atomic_storage = typename atomic_storage_selector<T>::type;
+}
+
+#endif
@@ -0,0 +1,198 @@
+#ifndef INCLUDE_CONSTEXPR_MATH_H
+#define INCLUDE_CONSTEXPR_MATH_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "type_trait.h"
+
+/*
+ * One definition per kernel : a portable loop while constant evaluating,
+ * the builtin, intrinsic or libc routine at runtime. Both sides give the same result.
+ */
+namespace constexpr_math {
+    using namespace type_properties;
+    using constant_evaluation_context::is_constant_evaluated;
+
+    namespace detail {
+        template<typename T>
+        constexpr void check_unsigned() noexcept {
+            static_assert(is_unsigned_v<T> && sizeof(T) <= sizeof(unsigned long long),
+                          "constexpr_math : bit functions take unsigned integers");
+        }
+    }
+
+    template<typename T>
+    constexpr int popcount(T x) noexcept {
+        detail::check_unsigned<T>();
+        if (is_constant_evaluated()) {
+            int count = 0;
+            for (; x != 0; x &= x - 1) {
+                ++count;
+            }
+            return count;
+        }
+        return __builtin_popcountll(x);
+    }
+
+    /*Leading zero bits, digits of T for 0*/
+    template<typename T>
+    constexpr int clz(T x) noexcept {
+        detail::check_unsigned<T>();
+        constexpr int digits = std::numeric_limits<T>::digits;
+        if (x == 0) {
+            return digits;
+        }
+        if (is_constant_evaluated()) {
+            int count = 0;
+            for (T bit = T(1) << (digits - 1); (x & bit) == 0; bit >>= 1) {
+                ++count;
+            }
+            return count;
+        }
+        return __builtin_clzll(x) - (std::numeric_limits<unsigned long long>::digits - digits);
+    }
+
+    /*Trailing zero bits, digits of T for 0*/
+    template<typename T>
+    constexpr int ctz(T x) noexcept {
+        detail::check_unsigned<T>();
+        if (x == 0) {
+            return std::numeric_limits<T>::digits;
+        }
+        if (is_constant_evaluated()) {
+            int count = 0;
+            for (; (x & 1) == 0; x >>= 1) {
+                ++count;
+            }
+            return count;
+        }
+        return __builtin_ctzll(x);
+    }
+
+    /*floor(log2(x)), -1 for 0*/
+    template<typename T>
+    constexpr int log2(T x) noexcept {
+        return std::numeric_limits<T>::digits - 1 - clz(x);
+    }
+
+    /*
+     * Correctly rounded square root, like sqrtsd.
+     * At compile time x = m * 2^e with m a 53 or 54-bit integer and e even,
+     * then sqrt(m * 2^52) is an exact integer square root on 128 bits rounded to nearest.
+     */
+    constexpr double sqrt(double x) noexcept {
+        if (is_constant_evaluated()) {
+            if (x != x || x == 0 || x == std::numeric_limits<double>::infinity()) {
+                return x;
+            }
+            if (x < 0) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            int e = 0;
+            for (; x >= 9007199254740992.0; x *= 0.5) {
+                ++e;
+            }
+            for (; x < 4503599627370496.0; x *= 2) {
+                --e;
+            }
+            unsigned __int128 m = static_cast<std::uint64_t>(x);
+            if (e % 2 != 0) {
+                m <<= 1;
+                --e;
+            }
+            unsigned __int128 target = m << 52;
+            /*Bit by bit integer square root : root < 2^53*/
+            unsigned __int128 root = 0;
+            for (int bit = 52; bit >= 0; --bit) {
+                unsigned __int128 candidate = root | (static_cast<unsigned __int128>(1) << bit);
+                if (candidate * candidate <= target) {
+                    root = candidate;
+                }
+            }
+            /*Ties cannot happen : sqrt of an integer is never r + 1/2*/
+            if (target - root * root > root) {
+                ++root;
+            }
+            double result = static_cast<double>(static_cast<std::uint64_t>(root));
+            for (int half = (e - 52) / 2; half > 0; --half) {
+                result *= 2;
+            }
+            for (int half = (e - 52) / 2; half < 0; ++half) {
+                result *= 0.5;
+            }
+            return result;
+        }
+#if defined(__SSE2__)
+        return _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), _mm_set_sd(x)));
+#else
+        return std::sqrt(x);
+#endif
+    }
+
+    /*Set bits over a whole array, four words per step with AVX2*/
+    constexpr std::size_t popcount(const std::uint64_t* words, std::size_t count) noexcept {
+        std::size_t total = 0;
+        std::size_t i = 0;
+        if (!is_constant_evaluated()) {
+#if defined(__AVX2__)
+            /*Nibble lookup table, byte counts summed by _mm256_sad_epu8*/
+            const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                   0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const __m256i low = _mm256_set1_epi8(0x0f);
+            __m256i sums = _mm256_setzero_si256();
+            for (std::size_t blocks = count / 4 * 4; i < blocks; i += 4) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+                __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(table, _mm256_and_si256(v, low)),
+                                                _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), low)));
+                sums = _mm256_add_epi64(sums, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+            }
+            alignas(32) std::uint64_t lanes[4] = {};
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), sums);
+            total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+        }
+        for (; i < count; ++i) {
+            total += popcount(words[i]);
+        }
+        return total;
+    }
+
+    /*out[i] = sqrt(in[i]), four lanes per step with AVX*/
+    constexpr void sqrt(const double* in, std::size_t count, double* out) noexcept {
+        std::size_t i = 0;
+        if (!is_constant_evaluated()) {
+#if defined(__AVX__)
+            for (std::size_t blocks = count / 4 * 4; i < blocks; i += 4) {
+                _mm256_storeu_pd(out + i, _mm256_sqrt_pd(_mm256_loadu_pd(in + i)));
+            }
+#endif
+        }
+        for (; i < count; ++i) {
+            out[i] = sqrt(in[i]);
+        }
+    }
+
+    /*memcpy of count elements : an element loop at compile time, libc's vectorized memcpy at runtime*/
+    template<typename T>
+    constexpr T* copy(const T* first, std::size_t count, T* out) noexcept {
+        static_assert(is_trivially_copyable_v<T>, "constexpr_math::copy : T must be trivially copyable");
+        if (is_constant_evaluated()) {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = first[i];
+            }
+        } else if (count != 0) {
+            std::memcpy(out, first, count * sizeof(T));
+        }
+        return out + count;
+    }
+}
+
+#endif
@@ -0,0 +1,222 @@
+#ifndef INCLUDE_ENUM_REFLECTION_H
+#define INCLUDE_ENUM_REFLECTION_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "type_trait.h"
+#include "perfect_hash.h"
+
+/*Enum <-> string conversion from compile-time name tables*/
+namespace enum_reflection {
+    using namespace type_categories;
+
+    /*
+     * Specialize to widen or narrow the scanned values of E.
+     * The default only serves enums with a fixed underlying type : the values of
+     * any other enum end at the bits of its largest enumerator, and converting a
+     * value past that is not a constant expression. Such an enum needs its own
+     * enum_range, within those bits.
+     */
+    template<typename E>
+    struct enum_range {
+        static constexpr int min = -128;
+        static constexpr int max = 128;
+        static constexpr bool is_default = true;
+    };
+
+    namespace detail {
+        /*
+         * Note : names are cut out of __PRETTY_FUNCTION__, which is a compiler feature.
+         * GCC : "... [with E = ns::Color; E V = ns::Color::Red; ...]"
+         * Clang : "... [E = ns::Color, V = ns::Color::Red]"
+         * A value without enumerator is printed as a cast "(ns::Color)3".
+         */
+        constexpr std::string_view parse_name(std::string_view signature) noexcept {
+            std::size_t begin = signature.find("V = ");
+            if (begin == std::string_view::npos) {
+                return {};
+            }
+            begin += 4;
+
+            std::size_t end = signature.find_first_of(";,]", begin);
+            std::string_view name = signature.substr(begin, end - begin);
+            if (name.empty() || name[0] == '(' || name[0] == '-' || (name[0] >= '0' && name[0] <= '9')) {
+                return {};
+            }
+
+            std::size_t scope = name.rfind("::");
+            if (scope != std::string_view::npos) {
+                name.remove_prefix(scope + 2);
+            }
+            return name;
+        }
+
+        template<typename E, E V>
+        constexpr std::string_view name_of() noexcept {
+#if defined(__clang__) || defined(__GNUC__)
+            return parse_name(__PRETTY_FUNCTION__);
+#else
+            static_assert(V != V, "enum_reflection needs __PRETTY_FUNCTION__");
+            return {};
+#endif
+        }
+
+        template<typename E>
+        using underlying_t = std::underlying_type_t<E>;
+
+        /*E{u} from an integer only compiles when E has a fixed underlying type*/
+        template<typename E>
+        class has_fixed_underlying_type {
+            private:
+                template<typename C>
+                static char test(decltype(C{std::declval<underlying_t<C>>()})*);
+
+                template<typename C>
+                static long test(...);
+
+            public:
+                static constexpr bool value = sizeof(test<E>(0)) == sizeof(char);
+        };
+
+        template<typename E>
+        class has_default_range {
+            private:
+                template<typename C>
+                static char test(decltype(&enum_range<C>::is_default));
+
+                template<typename C>
+                static long test(...);
+
+            public:
+                static constexpr bool value = sizeof(test<E>(0)) == sizeof(char);
+        };
+
+        template<typename E>
+        constexpr long long clamp_to_underlying(long long value) noexcept {
+            using limits = std::numeric_limits<underlying_t<E>>;
+
+            if (value < static_cast<long long>(limits::min())) {
+                return static_cast<long long>(limits::min());
+            }
+            if (value > 0 && static_cast<unsigned long long>(value) > static_cast<unsigned long long>(limits::max())) {
+                return static_cast<long long>(limits::max());
+            }
+            return value;
+        }
+
+        template<typename E>
+        inline constexpr long long range_min = clamp_to_underlying<E>(enum_range<E>::min);
+
+        template<typename E>
+        inline constexpr long long range_max = clamp_to_underlying<E>(enum_range<E>::max);
+
+        /*Empty when enum_range<E> lies wholly outside the underlying type*/
+        template<typename E>
+        inline constexpr std::size_t range_size =
+            enum_range<E>::max < range_min<E> || enum_range<E>::min > range_max<E>
+                ? 0
+                : static_cast<std::size_t>(range_max<E> - range_min<E> + 1);
+
+        template<typename E, std::size_t... Is>
+        constexpr std::array<std::string_view, sizeof...(Is)> scan(std::index_sequence<Is...>) noexcept {
+            static_assert(has_fixed_underlying_type<E>::value || !has_default_range<E>::value,
+                          "enum_reflection: an enum without fixed underlying type needs an enum_range specialization");
+            return {{name_of<E, static_cast<E>(range_min<E> + static_cast<long long>(Is))>()...}};
+        }
+
+        /*Name of every value in [range_min, range_max], empty where there is no enumerator*/
+        template<typename E>
+        inline constexpr auto dense_names = scan<E>(std::make_index_sequence<range_size<E>>{});
+
+        template<typename E>
+        constexpr std::size_t count() noexcept {
+            std::size_t n = 0;
+            for (std::string_view name : dense_names<E>) {
+                n += !name.empty();
+            }
+            return n;
+        }
+    }
+
+    template<typename E>
+    inline constexpr std::size_t enum_count_v = detail::count<E>();
+
+    namespace detail {
+        template<typename E>
+        constexpr std::array<E, enum_count_v<E>> values() noexcept {
+            std::array<E, enum_count_v<E>> result{};
+            std::size_t n = 0;
+            for (std::size_t i = 0; i < range_size<E>; ++i) {
+                if (!dense_names<E>[i].empty()) {
+                    result[n++] = static_cast<E>(range_min<E> + static_cast<long long>(i));
+                }
+            }
+            return result;
+        }
+
+        template<typename E>
+        constexpr std::array<std::string_view, enum_count_v<E>> names() noexcept {
+            std::array<std::string_view, enum_count_v<E>> result{};
+            std::size_t n = 0;
+            for (std::string_view name : dense_names<E>) {
+                if (!name.empty()) {
+                    result[n++] = name;
+                }
+            }
+            return result;
+        }
+    }
+
+    /*Enumerators in ascending order of value*/
+    template<typename E>
+    inline constexpr std::array<E, enum_count_v<E>> enum_values_v = detail::values<E>();
+
+    template<typename E>
+    inline constexpr std::array<std::string_view, enum_count_v<E>> enum_names_v = detail::names<E>();
+
+    namespace detail {
+        template<typename E>
+        constexpr std::array<std::uint64_t, enum_count_v<E>> name_hashes() noexcept {
+            std::array<std::uint64_t, enum_count_v<E>> result{};
+            for (std::size_t i = 0; i < enum_count_v<E>; ++i) {
+                result[i] = perfect_hash::hash_bytes(enum_names_v<E>[i]);
+            }
+            return result;
+        }
+
+        template<typename E>
+        inline constexpr auto name_index = perfect_hash::make_chd(name_hashes<E>());
+    }
+
+    /*Empty string_view when value has no enumerator in enum_range<E>*/
+    template<typename E>
+    constexpr std::string_view enum_name(E value) noexcept {
+        static_assert(is_enum_v<E>, "enum_name needs an enum type");
+
+        long long offset = static_cast<long long>(value) - detail::range_min<E>;
+        if (offset < 0 || offset >= static_cast<long long>(detail::range_size<E>)) {
+            return {};
+        }
+        return detail::dense_names<E>[static_cast<std::size_t>(offset)];
+    }
+
+    template<typename E>
+    constexpr std::optional<E> enum_cast(std::string_view name) noexcept {
+        static_assert(is_enum_v<E>, "enum_cast needs an enum type");
+        static_assert(detail::name_index<E>.valid, "enum_cast: two enumerator names share a 64-bit hash");
+
+        std::size_t i = detail::name_index<E>.find(perfect_hash::hash_bytes(name));
+        if (i < enum_count_v<E> && enum_names_v<E>[i] == name) {
+            return enum_values_v<E>[i];
+        }
+        return std::nullopt;
+    }
+}
+
+#endif
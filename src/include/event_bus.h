@@ -0,0 +1,144 @@
+#ifndef INCLUDE_EVENT_BUS_H
+#define INCLUDE_EVENT_BUS_H
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include "type_trait.h"
+#include "function_traits.h"
+
+namespace callables {
+    using namespace type_relationships;
+    using namespace references;
+
+    /*
+     * Non-owning callable reference : one object pointer and one stub, no allocation.
+     * The bound object or lambda must outlive the delegate.
+     */
+    template<typename Signature>
+    class delegate;
+
+    template<typename R, typename... Args>
+    class delegate<R(Args...)> {
+        private:
+            using stub_type = R (*)(void*, Args...);
+
+            constexpr delegate(void* object, stub_type stub) noexcept : object_(object), stub_(stub) { }
+
+        public:
+            constexpr delegate() noexcept = default;
+
+            /*Free function or static member function*/
+            template<auto Function>
+            static constexpr delegate bind() noexcept {
+                using traits = function_traits<decltype(Function)>;
+                static_assert(!traits::is_member, "delegate::bind<Function>() : use bind<Method>(object)");
+                static_assert(traits::arity == sizeof...(Args), "delegate::bind : arity mismatch");
+
+                return delegate(nullptr, [](void*, Args... args) -> R {
+                    return Function(std::forward<Args>(args)...);
+                });
+            }
+
+            template<auto Method, typename C>
+            static constexpr delegate bind(C& object) noexcept {
+                using traits = function_traits<decltype(Method)>;
+                static_assert(traits::is_member, "delegate::bind<Method>(object) : Method must be a member function pointer");
+                static_assert(traits::arity == sizeof...(Args), "delegate::bind : arity mismatch");
+                static_assert(is_base_of<typename traits::class_type, remove_cv_t<C>>::value || is_same_v<typename traits::class_type, remove_cv_t<C>>,
+                              "delegate::bind : object is not of the method's class");
+
+                return delegate(const_cast<void*>(static_cast<const volatile void*>(&object)), [](void* self, Args... args) -> R {
+                    return (static_cast<C*>(self)->*Method)(std::forward<Args>(args)...);
+                });
+            }
+
+            /*Lambda or function object, referenced and not copied*/
+            template<typename Callable>
+            static constexpr delegate bind(Callable& callable) noexcept {
+                return delegate(const_cast<void*>(static_cast<const volatile void*>(&callable)), [](void* self, Args... args) -> R {
+                    return (*static_cast<Callable*>(self))(std::forward<Args>(args)...);
+                });
+            }
+
+            R operator()(Args... args) const {
+                return stub_(object_, std::forward<Args>(args)...);
+            }
+
+            constexpr explicit operator bool() const noexcept { return stub_ != nullptr; }
+
+        private:
+            void* object_ = nullptr;
+            stub_type stub_ = nullptr;
+    };
+
+    /*delegate with the signature read off the function pointer*/
+    template<auto Function>
+    constexpr auto make_delegate() noexcept {
+        return delegate<typename function_traits<decltype(Function)>::signature>::template bind<Function>();
+    }
+
+    template<auto Method, typename C>
+    constexpr auto make_delegate(C& object) noexcept {
+        return delegate<typename function_traits<decltype(Method)>::signature>::template bind<Method>(object);
+    }
+
+    template<auto... Handlers>
+    struct handlers { };
+
+    /*Event a one-argument handler subscribes to*/
+    template<auto Handler>
+    using handler_event_t = miscellaneous_transformation::remove_cvref_t<arg_t<decltype(Handler), 0>>;
+
+    template<typename HandlerList, typename... Listeners>
+    class event_bus;
+
+    /*
+     * Subscriptions fixed at compile time : publish<E> expands to a direct call of
+     * every handler whose only parameter is an E, no std::function and no virtual.
+     * Member function handlers are called on the listener of their class.
+     *
+     *     auto bus = make_event_bus<&log_tick, &Physics::on_tick, &Renderer::on_frame>(physics, renderer);
+     *     bus.publish(Tick{});
+     */
+    template<auto... Handlers, typename... Listeners>
+    class event_bus<handlers<Handlers...>, Listeners...> {
+        public:
+            explicit event_bus(Listeners&... listeners) noexcept : listeners_(&listeners...) { }
+
+            template<typename Event>
+            void publish(const Event& event) const {
+                (dispatch<Handlers>(event), ...);
+            }
+
+            template<typename Event>
+            static constexpr std::size_t subscriber_count() noexcept {
+                return (std::size_t(0) + ... + std::size_t(is_same_v<handler_event_t<Handlers>, Event>));
+            }
+
+        private:
+            template<auto Handler, typename Event>
+            void dispatch(const Event& event) const {
+                using traits = function_traits<decltype(Handler)>;
+                static_assert(traits::arity == 1, "event_bus : handlers take exactly the event");
+
+                if constexpr (is_same_v<handler_event_t<Handler>, Event>) {
+                    if constexpr (traits::is_member) {
+                        (std::get<typename traits::class_type*>(listeners_)->*Handler)(event);
+                    } else {
+                        Handler(event);
+                    }
+                }
+            }
+
+            std::tuple<Listeners*...> listeners_;
+    };
+
+    template<auto... Handlers, typename... Listeners>
+    event_bus<handlers<Handlers...>, Listeners...> make_event_bus(Listeners&... listeners) noexcept {
+        return event_bus<handlers<Handlers...>, Listeners...>(listeners...);
+    }
+}
+
+#endif
@@ -0,0 +1,211 @@
+#ifndef INCLUDE_FAST_CAST_H
+#define INCLUDE_FAST_CAST_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "type_trait.h"
+
+/*
+ * Constant-time downcasts for opt-in single-inheritance hierarchies.
+ * Classes are numbered in pre-order, so a class and everything derived from it
+ * occupy one interval [first, first + size) and a downcast check is one range compare.
+ *
+ *     struct Animal : hierarchy_root<Animal> { };
+ *     struct Dog : hierarchy_node<Dog, Animal> { };
+ *     struct Cat : hierarchy_node<Cat, Animal> { };
+ *
+ *     template<>
+ *     struct class_hierarchy_of<Animal> { using type = class_hierarchy<Animal, Dog, Cat>; };
+ */
+namespace hierarchy {
+    using namespace type_relationships;
+    using namespace miscellaneous_transformation;
+
+    using hierarchy_id = std::uint32_t;
+
+    /*Specialize for every root with the class_hierarchy listing its registered classes*/
+    template<typename Root>
+    struct class_hierarchy_of;
+
+    template<typename Root>
+    class hierarchy_root {
+        public:
+            using hierarchy_parent = void;
+
+            hierarchy_id dynamic_hierarchy_id() const noexcept { return hierarchy_id_; }
+
+        protected:
+            hierarchy_root() noexcept = default;
+
+            /*The id follows the object, not its value : copies are stamped by their own most derived class*/
+            hierarchy_root(const hierarchy_root&) noexcept { }
+
+            hierarchy_root(hierarchy_root&&) noexcept { }
+
+            hierarchy_root& operator=(const hierarchy_root&) noexcept { return *this; }
+
+            hierarchy_root& operator=(hierarchy_root&&) noexcept { return *this; }
+
+
+            /*The root is always first in pre-order*/
+            hierarchy_id hierarchy_id_ = 0;
+    };
+
+    template<typename T, typename Parent = typename T::hierarchy_parent>
+    struct root_of {
+        using type = typename root_of<Parent>::type;
+    };
+
+    template<typename T>
+    struct root_of<T, void> {
+        using type = T;
+    };
+
+    template<typename T>
+    using root_of_t = typename root_of<T>::type;
+
+    namespace detail {
+        template<typename T, typename... Classes>
+        struct index_of;
+
+        template<typename T>
+        struct index_of<T> : public integral_constant<std::size_t, 0> { };
+
+        template<typename T, typename... Rest>
+        struct index_of<T, T, Rest...> : public integral_constant<std::size_t, 0> { };
+
+        template<typename T, typename U, typename... Rest>
+        struct index_of<T, U, Rest...> : public integral_constant<std::size_t, 1 + index_of<T, Rest...>::value> { };
+
+        /*Parent of every class, sizeof...(Classes) for the root*/
+        template<typename T, typename... Classes>
+        constexpr std::size_t parent_index() noexcept {
+            using parent = typename T::hierarchy_parent;
+            if constexpr (is_same_v<parent, void>) {
+                return sizeof...(Classes);
+            } else {
+                static_assert(is_base_of<parent, T>::value, "hierarchy_parent must be a base of the registered class");
+                static_assert(index_of<parent, Classes...>::value < sizeof...(Classes),
+                              "hierarchy_parent must be registered in the same class_hierarchy");
+                return index_of<parent, Classes...>::value;
+            }
+        }
+
+        template<typename Node, typename... Args>
+        struct is_copy_of : public false_type { };
+
+        template<typename Node, typename Arg>
+        struct is_copy_of<Node, Arg> : public bool_constant<is_base_of<Node, remove_cvref_t<Arg>>::value> { };
+
+        struct interval {
+            hierarchy_id first;
+            hierarchy_id size;
+        };
+
+        template<std::size_t N>
+        constexpr hierarchy_id number(const std::array<std::size_t, N>& parents,
+                                      std::array<interval, N>& intervals,
+                                      std::size_t node, hierarchy_id next) noexcept {
+            intervals[node].first = next++;
+            for (std::size_t child = 0; child < N; ++child) {
+                if (parents[child] == node) {
+                    next = number(parents, intervals, child, next);
+                }
+            }
+            intervals[node].size = next - intervals[node].first;
+            return next;
+        }
+
+        template<std::size_t N>
+        constexpr std::array<interval, N> pre_order(const std::array<std::size_t, N>& parents) noexcept {
+            std::array<interval, N> intervals{};
+            number(parents, intervals, 0, 0);
+            return intervals;
+        }
+    }
+
+    template<typename Root, typename... Classes>
+    struct class_hierarchy {
+        static_assert(is_same_v<typename Root::hierarchy_parent, void>, "the first registered class must be the root");
+
+        using root = Root;
+
+        static constexpr std::size_t size = 1 + sizeof...(Classes);
+
+        static constexpr std::array<std::size_t, size> parents = {{
+            detail::parent_index<Root, Root, Classes...>(),
+            detail::parent_index<Classes, Root, Classes...>()...}};
+
+        static constexpr std::array<detail::interval, size> intervals = detail::pre_order(parents);
+
+        template<typename T>
+        static constexpr detail::interval interval_of() noexcept {
+            constexpr std::size_t index = detail::index_of<T, Root, Classes...>::value;
+            static_assert(index < size, "class is not registered in its class_hierarchy");
+            return intervals[index];
+        }
+    };
+
+    template<typename T>
+    using class_hierarchy_t = typename class_hierarchy_of<root_of_t<T>>::type;
+
+    template<typename T>
+    constexpr hierarchy_id static_hierarchy_id() noexcept {
+        return class_hierarchy_t<T>::template interval_of<T>().first;
+    }
+
+    /*Base of a registered class : stamps the most derived id as construction goes down the chain*/
+    template<typename Derived, typename Base>
+    class hierarchy_node : public Base {
+        public:
+            using hierarchy_parent = Base;
+
+            /*Not a candidate for copies, a non-const lvalue would pick it over the copy constructor*/
+            template<typename... Args,
+                     typename = enable_if_t<!detail::is_copy_of<hierarchy_node, Args...>::value>>
+            hierarchy_node(Args&&... args) : Base(std::forward<Args>(args)...) {
+                this->hierarchy_id_ = static_hierarchy_id<Derived>();
+            }
+
+            hierarchy_node(const hierarchy_node& other) : Base(other) {
+                this->hierarchy_id_ = static_hierarchy_id<Derived>();
+            }
+
+            hierarchy_node(hierarchy_node&& other) : Base(std::move(other)) {
+                this->hierarchy_id_ = static_hierarchy_id<Derived>();
+            }
+
+            hierarchy_node& operator=(const hierarchy_node&) = default;
+
+            hierarchy_node& operator=(hierarchy_node&&) = default;
+    };
+
+    template<typename Derived, typename Base>
+    bool is_instance_of(const Base& object) noexcept {
+        static_assert(is_base_of<Base, Derived>::value, "is_instance_of: Derived must derive from Base");
+        constexpr detail::interval range = class_hierarchy_t<Derived>::template interval_of<Derived>();
+        return static_cast<hierarchy_id>(object.dynamic_hierarchy_id() - range.first) < range.size;
+    }
+
+    /*dynamic_cast replacement for pointers, nullptr when object is not a Derived*/
+    template<typename Derived, typename Base>
+    Derived* fast_cast(Base* object) noexcept {
+        if (object != nullptr && is_instance_of<Derived>(*object)) {
+            return static_cast<Derived*>(object);
+        }
+        return nullptr;
+    }
+
+    template<typename Derived, typename Base>
+    const Derived* fast_cast(const Base* object) noexcept {
+        if (object != nullptr && is_instance_of<Derived>(*object)) {
+            return static_cast<const Derived*>(object);
+        }
+        return nullptr;
+    }
+}
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef INCLUDE_FUNCTION_TRAITS_H
+#define INCLUDE_FUNCTION_TRAITS_H
+
+#include <cstddef>
+#include <tuple>
+
+#include "type_trait.h"
+
+/*Signature decomposition for functions, function pointers, member function pointers and lambdas*/
+namespace callables {
+    using namespace type_categories;
+
+    enum class ref_qualifier { none, lvalue, rvalue };
+
+    namespace detail {
+        template<bool Variadic, bool Const, bool Volatile, ref_qualifier Ref, bool Noexcept, typename R, typename... Args>
+        struct function_traits_base {
+            using return_type = R;
+            using args_tuple = std::tuple<Args...>;
+            /*Unqualified signature, what a delegate stores*/
+            using signature = R(Args...);
+
+            template<std::size_t I>
+            using arg_t = std::tuple_element_t<I, args_tuple>;
+
+            static constexpr std::size_t arity = sizeof...(Args);
+            static constexpr bool is_variadic = Variadic;
+            static constexpr bool is_const = Const;
+            static constexpr bool is_volatile = Volatile;
+            static constexpr ref_qualifier ref = Ref;
+            static constexpr bool is_noexcept = Noexcept;
+            static constexpr bool is_member = false;
+        };
+    }
+
+    /*Callable class types : the traits of their operator()*/
+    template<typename F>
+    struct function_traits : public function_traits<decltype(&F::operator())> {
+        static constexpr bool is_member = false;
+    };
+
+    template<typename F>
+    struct function_traits<F&> : public function_traits<F> { };
+
+    template<typename F>
+    struct function_traits<F&&> : public function_traits<F> { };
+
+    template<typename F>
+    struct function_traits<F const> : public function_traits<F> { };
+
+    template<typename F>
+    struct function_traits<F volatile> : public function_traits<F> { };
+
+    template<typename F>
+    struct function_traits<F const volatile> : public function_traits<F> { };
+
+    template<typename R, typename... Args>
+    struct function_traits<R(*)(Args...)> : public function_traits<R(Args...)> { };
+
+    template<typename R, typename... Args>
+    struct function_traits<R(*)(Args......)> : public function_traits<R(Args......)> { };
+
+    template<typename R, typename... Args>
+    struct function_traits<R(*)(Args...) noexcept> : public function_traits<R(Args...) noexcept> { };
+
+    template<typename R, typename... Args>
+    struct function_traits<R(*)(Args......) noexcept> : public function_traits<R(Args......) noexcept> { };
+
+    /*Member function pointers of every qualification, F is the qualified function type*/
+    template<typename F, typename C>
+    struct function_traits<F C::*> : public function_traits<F> {
+        static_assert(is_function<F>::value, "function_traits: member object pointers are not callable");
+
+        using class_type = C;
+        static constexpr bool is_member = true;
+    };
+
+    /*One specialization per qualification of the is_function set*/
+#define CALLABLES_FUNCTION_TRAITS(QUALIFIERS, CONST, VOLATILE, REF, NOEXCEPT)                               \
+    template<typename R, typename... Args>                                                                \
+    struct function_traits<R(Args...) QUALIFIERS>                                                         \
+        : public detail::function_traits_base<false, CONST, VOLATILE, REF, NOEXCEPT, R, Args...> { };     \
+    template<typename R, typename... Args>                                                                \
+    struct function_traits<R(Args......) QUALIFIERS>                                                      \
+        : public detail::function_traits_base<true, CONST, VOLATILE, REF, NOEXCEPT, R, Args...> { };
+
+    CALLABLES_FUNCTION_TRAITS(, false, false, ref_qualifier::none, false)
+    CALLABLES_FUNCTION_TRAITS(const, true, false, ref_qualifier::none, false)
+    CALLABLES_FUNCTION_TRAITS(volatile, false, true, ref_qualifier::none, false)
+    CALLABLES_FUNCTION_TRAITS(const volatile, true, true, ref_qualifier::none, false)
+    CALLABLES_FUNCTION_TRAITS(&, false, false, ref_qualifier::lvalue, false)
+    CALLABLES_FUNCTION_TRAITS(const &, true, false, ref_qualifier::lvalue, false)
+    CALLABLES_FUNCTION_TRAITS(volatile &, false, true, ref_qualifier::lvalue, false)
+    CALLABLES_FUNCTION_TRAITS(const volatile &, true, true, ref_qualifier::lvalue, false)
+    CALLABLES_FUNCTION_TRAITS(&&, false, false, ref_qualifier::rvalue, false)
+    CALLABLES_FUNCTION_TRAITS(const &&, true, false, ref_qualifier::rvalue, false)
+    CALLABLES_FUNCTION_TRAITS(volatile &&, false, true, ref_qualifier::rvalue, false)
+    CALLABLES_FUNCTION_TRAITS(const volatile &&, true, true, ref_qualifier::rvalue, false)
+    CALLABLES_FUNCTION_TRAITS(noexcept, false, false, ref_qualifier::none, true)
+    CALLABLES_FUNCTION_TRAITS(const noexcept, true, false, ref_qualifier::none, true)
+    CALLABLES_FUNCTION_TRAITS(volatile noexcept, false, true, ref_qualifier::none, true)
+    CALLABLES_FUNCTION_TRAITS(const volatile noexcept, true, true, ref_qualifier::none, true)
+    CALLABLES_FUNCTION_TRAITS(& noexcept, false, false, ref_qualifier::lvalue, true)
+    CALLABLES_FUNCTION_TRAITS(const & noexcept, true, false, ref_qualifier::lvalue, true)
+    CALLABLES_FUNCTION_TRAITS(volatile & noexcept, false, true, ref_qualifier::lvalue, true)
+    CALLABLES_FUNCTION_TRAITS(const volatile & noexcept, true, true, ref_qualifier::lvalue, true)
+    CALLABLES_FUNCTION_TRAITS(&& noexcept, false, false, ref_qualifier::rvalue, true)
+    CALLABLES_FUNCTION_TRAITS(const && noexcept, true, false, ref_qualifier::rvalue, true)
+    CALLABLES_FUNCTION_TRAITS(volatile && noexcept, false, true, ref_qualifier::rvalue, true)
+    CALLABLES_FUNCTION_TRAITS(const volatile && noexcept, true, true, ref_qualifier::rvalue, true)
+
+#undef CALLABLES_FUNCTION_TRAITS
+
+    template<typename F>
+    using return_type_t = typename function_traits<F>::return_type;
+
+    template<typename F, std::size_t I>
+    using arg_t = typename function_traits<F>::template arg_t<I>;
+
+    template<typename F>
+    inline constexpr std::size_t arity_v = function_traits<F>::arity;
+}
+
+#endif
@@ -0,0 +1,198 @@
+#ifndef INCLUDE_HASHING_H
+#define INCLUDE_HASHING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "type_trait.h"
+
+/*Hashing driven by has_unique_object_representations*/
+namespace hashing {
+    using namespace type_properties;
+    using namespace arrays;
+    using namespace miscellaneous_transformation;
+
+    namespace detail {
+        inline constexpr std::uint64_t secret[4] = {
+            0xbe4ba423396cfeb8ull, 0x1cad21f72c81017cull, 0xdb979083e96dd4deull, 0x1f67b3b7a4a44072ull};
+
+        inline std::uint64_t load64(const unsigned char* p) noexcept {
+            std::uint64_t w;
+            std::memcpy(&w, p, sizeof(w));
+            return w;
+        }
+
+        inline std::uint32_t load32(const unsigned char* p) noexcept {
+            std::uint32_t w;
+            std::memcpy(&w, p, sizeof(w));
+            return w;
+        }
+
+        inline std::uint64_t mix16(std::uint64_t a, std::uint64_t b, std::uint64_t seed) noexcept {
+            unsigned __int128 product = static_cast<unsigned __int128>(a ^ secret[0] ^ seed) * (b ^ secret[1]);
+            return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+        }
+
+        /*
+         * One 32-byte stripe into four 64-bit lanes : lane += lo32(w ^ s) * hi32(w ^ s) + w.
+         * The 32x32->64 multiply is what SSE2 (pmuludq) and AVX2 vectorise, the
+         * scalar and SIMD paths produce identical lanes.
+         */
+        inline void accumulate(std::uint64_t* acc, const unsigned char* p, std::size_t stripes) noexcept {
+#if defined(__AVX2__)
+            __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc));
+            const __m256i key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret));
+            for (std::size_t s = 0; s < stripes; ++s, p += 32) {
+                __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+                __m256i keyed = _mm256_xor_si256(data, key);
+                __m256i product = _mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32));
+                lanes = _mm256_add_epi64(lanes, _mm256_add_epi64(product, data));
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc), lanes);
+#elif defined(__SSE2__)
+            __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc));
+            __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc + 2));
+            const __m128i key_low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret));
+            const __m128i key_high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret + 2));
+            for (std::size_t s = 0; s < stripes; ++s, p += 32) {
+                __m128i data_low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                __m128i data_high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16));
+                __m128i keyed_low = _mm_xor_si128(data_low, key_low);
+                __m128i keyed_high = _mm_xor_si128(data_high, key_high);
+                low = _mm_add_epi64(low, _mm_add_epi64(_mm_mul_epu32(keyed_low, _mm_srli_epi64(keyed_low, 32)), data_low));
+                high = _mm_add_epi64(high, _mm_add_epi64(_mm_mul_epu32(keyed_high, _mm_srli_epi64(keyed_high, 32)), data_high));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(acc), low);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(acc + 2), high);
+#else
+            for (std::size_t s = 0; s < stripes; ++s, p += 32) {
+                for (std::size_t lane = 0; lane < 4; ++lane) {
+                    std::uint64_t data = load64(p + 8 * lane);
+                    std::uint64_t keyed = data ^ secret[lane];
+                    acc[lane] += (keyed & 0xffffffffull) * (keyed >> 32) + data;
+                }
+            }
+#endif
+        }
+    }
+
+    /*Hash of n bytes in one pass, short inputs skip the lanes*/
+    inline std::uint64_t hash_bytes(const void* data, std::size_t n, std::uint64_t seed = 0) noexcept {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+
+        if (n <= 16) {
+            std::uint64_t a = 0;
+            std::uint64_t b = 0;
+            if (n >= 8) {
+                a = detail::load64(p);
+                b = detail::load64(p + n - 8);
+            } else if (n >= 4) {
+                a = detail::load32(p);
+                b = detail::load32(p + n - 4);
+            } else if (n > 0) {
+                a = static_cast<std::uint64_t>(p[0]) << 16 | static_cast<std::uint64_t>(p[n / 2]) << 8 | p[n - 1];
+            }
+            return detail::mix16(a ^ detail::secret[2], b ^ n, seed);
+        }
+
+        std::uint64_t acc[4] = {seed, seed ^ detail::secret[2], seed + detail::secret[3], seed - detail::secret[0]};
+        detail::accumulate(acc, p, n / 32);
+        /*Partial stripe : the last 32 bytes again, or the first and the last 16 (overlapping) below 32*/
+        std::uint64_t tail = 0;
+        if (n % 32 != 0) {
+            if (n >= 32) {
+                detail::accumulate(acc, p + n - 32, 1);
+            } else {
+                tail = detail::mix16(detail::load64(p), detail::load64(p + 8), seed ^ detail::secret[3]) +
+                       detail::mix16(detail::load64(p + n - 16), detail::load64(p + n - 8), seed);
+            }
+        }
+
+        std::uint64_t h = n * 0x9e3779b97f4a7c15ull ^ tail;
+        return detail::mix16(detail::mix16(acc[0] ^ h, acc[1], seed), detail::mix16(acc[2], acc[3] ^ h, seed), n);
+    }
+
+    inline std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t value) noexcept {
+        return detail::mix16(seed, value, 0x2545f4914f6cdd1dull);
+    }
+
+    /*
+     * Per-field hashing for types that are not uniquely represented, declared
+     * next to the type and found by ADL :
+     *
+     *     auto hash_members(const Key& key) { return std::tie(key.a, key.b); }
+     */
+    template<typename T>
+    class has_hash_members {
+        private:
+            template<typename C>
+            static char test(decltype(hash_members(std::declval<const C&>()))*);
+
+            template<typename C>
+            static long test(...);
+
+        public:
+            static constexpr bool value = sizeof(test<T>(0)) == sizeof(char);
+    };
+
+    template<typename T>
+    inline constexpr bool has_hash_members_v = has_hash_members<T>::value;
+
+    template<typename T>
+    std::uint64_t hash_value(const T& value) noexcept;
+
+    namespace detail {
+        template<typename Tuple, std::size_t... Is>
+        std::uint64_t hash_tuple(const Tuple& fields, std::index_sequence<Is...>) noexcept {
+            std::uint64_t h = 0;
+            ((h = hash_combine(h, hash_value(std::get<Is>(fields)))), ...);
+            return h;
+        }
+    }
+
+    template<typename T>
+    std::uint64_t hash_value(const T& value) noexcept {
+        if constexpr (has_unique_object_representations_v<T>) {
+            /*Every byte is value, arrays of such types included : one pass over the memory*/
+            return hash_bytes(&value, sizeof(T));
+        } else if constexpr (is_floating_point_v<remove_cv_t<T>>) {
+            /*+0.0 == -0.0 must hash the same, long double is narrowed as its padding bytes are garbage*/
+            using narrow_t = conditional_t<(sizeof(T) > sizeof(double)), double, remove_cv_t<T>>;
+            narrow_t normalized = value == 0 ? narrow_t(0) : static_cast<narrow_t>(value);
+            return hash_bytes(&normalized, sizeof(normalized));
+        } else if constexpr (is_bounded_array_v<T>) {
+            std::uint64_t h = 0;
+            for (const auto& element : value) {
+                h = hash_combine(h, hash_value(element));
+            }
+            return h;
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            std::string_view bytes = value;
+            return hash_bytes(bytes.data(), bytes.size());
+        } else if constexpr (has_hash_members_v<T>) {
+            auto fields = hash_members(value);
+            return detail::hash_tuple(fields, std::make_index_sequence<std::tuple_size<decltype(fields)>::value>{});
+        } else {
+            static_assert(has_hash_members_v<T>, "hash_value: T has padding or is not trivial, declare hash_members(const T&)");
+            return 0;
+        }
+    }
+
+    /*Drop-in hasher for unordered containers*/
+    template<typename T>
+    struct hasher {
+        std::size_t operator()(const T& value) const noexcept {
+            return static_cast<std::size_t>(hash_value(value));
+        }
+    };
+}
+
+#endif
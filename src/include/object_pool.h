@@ -0,0 +1,237 @@
+#ifndef INCLUDE_OBJECT_POOL_H
+#define INCLUDE_OBJECT_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "type_trait.h"
+#include "atomic_storage.h"
+
+namespace containers {
+    using namespace supported_operations;
+
+    /*Storage handed back without running a constructor or a destructor*/
+    template<typename T>
+    struct is_pool_reusable : public bool_constant<
+                                     is_trivially_default_constructible_v<T> &&
+                                     is_trivially_destructible_v<T>> { };
+
+    template<typename T>
+    inline constexpr bool is_pool_reusable_v = is_pool_reusable<T>::value;
+
+    /*
+     * Fixed-size object allocator : T lives in slabs of slab_bytes, a dead object's storage
+     * holds the free list link. Each thread allocates from and frees to its own cache;
+     * the shared free list and the slabs are only touched, under a lock, by batches of cache_batch.
+     * A thread hands its cache back to the shared list when it exits.
+     *
+     * For a reusable T (is_pool_reusable), create() with no arguments default-initializes and
+     * destroy() runs no destructor : the value is indeterminate, the free list link overwrote
+     * its first bytes.
+     * Note : objects still alive when the pool is destroyed are not destroyed, only their storage is freed.
+     */
+    template<typename T>
+    class object_pool {
+        static_assert(is_object_v<T> && !is_array_v<T>, "object_pool holds single objects");
+        static_assert(is_destructible_v<T>, "object_pool needs a destructible type");
+
+        private:
+            union slot {
+                slot* next;
+                alignas(T) unsigned char storage[sizeof(T)];
+            };
+
+            struct free_list {
+                slot* head = nullptr;
+                std::size_t size = 0;
+
+                void push(slot* item) noexcept {
+                    item->next = head;
+                    head = item;
+                    ++size;
+                }
+
+                slot* pop() noexcept {
+                    slot* item = head;
+                    if (item != nullptr) {
+                        head = item->next;
+                        --size;
+                    }
+                    return item;
+                }
+            };
+
+            /*Touched by its thread only, on its own cache line*/
+            struct alignas(concurrency::cache_line_size) thread_cache {
+                free_list items;
+            };
+
+            /*Shared state, kept alive by an exiting thread that still hands its cache back*/
+            struct core {
+                std::mutex mutex;
+                free_list shared;
+                std::vector<std::unique_ptr<slot[]>> slabs;
+                std::size_t carved = slab_objects;
+                std::unordered_map<std::thread::id, std::unique_ptr<thread_cache>> caches;
+            };
+
+            /*Caches of the calling thread, flushed to the pools still alive when the thread exits*/
+            struct thread_exit {
+                std::vector<std::pair<std::weak_ptr<core>, thread_cache*>> caches;
+
+                ~thread_exit() {
+                    for (auto& [owner, cache] : caches) {
+                        if (std::shared_ptr<core> pool = owner.lock()) {
+                            std::lock_guard<std::mutex> lock(pool->mutex);
+                            while (slot* item = cache->items.pop()) {
+                                pool->shared.push(item);
+                            }
+                            pool->caches.erase(std::this_thread::get_id());
+                        }
+                    }
+                }
+            };
+
+        public:
+            using value_type = T;
+            using size_type = std::size_t;
+
+            static constexpr bool reuses_storage = is_pool_reusable_v<T>;
+            static constexpr size_type slab_bytes = 64 * 1024;
+            static constexpr size_type slab_objects = slab_bytes / sizeof(slot) > 0 ? slab_bytes / sizeof(slot) : 1;
+            static constexpr size_type cache_batch = 32;
+            static constexpr size_type cache_limit = 2 * cache_batch;
+
+            object_pool() : id_(next_id()), core_(std::make_shared<core>()) { }
+
+            object_pool(const object_pool&) = delete;
+            object_pool& operator=(const object_pool&) = delete;
+
+            template<typename... Args>
+            T* create(Args&&... args) {
+                thread_cache& cache = local_cache();
+                slot* item = cache.items.pop();
+                if (item == nullptr) {
+                    refill(cache);
+                    item = cache.items.pop();
+                }
+                if constexpr (sizeof...(Args) == 0 && reuses_storage) {
+                    return ::new (static_cast<void*>(item->storage)) T;
+                } else {
+                    /*A throwing constructor gives the slot back*/
+                    try {
+                        return construct(item, std::forward<Args>(args)...);
+                    } catch (...) {
+                        cache.items.push(item);
+                        throw;
+                    }
+                }
+            }
+
+            /*object must come from create() of this pool, from any thread*/
+            void destroy(T* object) noexcept {
+                if constexpr (!reuses_storage) {
+                    object->~T();
+                }
+                thread_cache& cache = local_cache();
+                cache.items.push(reinterpret_cast<slot*>(object));
+                if (cache.items.size > cache_limit) {
+                    spill(cache);
+                }
+            }
+
+            size_type slab_count() const {
+                std::lock_guard<std::mutex> lock(core_->mutex);
+                return core_->slabs.size();
+            }
+
+        private:
+            template<typename... Args>
+            static T* construct(slot* item, Args&&... args) {
+                if constexpr (is_constructible_v<T, Args&&...>) {
+                    return ::new (static_cast<void*>(item->storage)) T(std::forward<Args>(args)...);
+                } else {
+                    return ::new (static_cast<void*>(item->storage)) T{std::forward<Args>(args)...};
+                }
+            }
+
+            static std::uint64_t next_id() noexcept {
+                static std::atomic<std::uint64_t> ids{0};
+                return ids.fetch_add(1, std::memory_order_relaxed) + 1;
+            }
+
+            /*Last pools this thread used, by id : a destroyed pool's id never comes back*/
+            thread_cache& local_cache() {
+                struct entry {
+                    std::uint64_t pool = 0;
+                    thread_cache* cache = nullptr;
+                };
+                static thread_local entry recent[4];
+
+                for (entry& e : recent) {
+                    if (e.pool == id_) {
+                        return *e.cache;
+                    }
+                }
+                thread_cache* cache = register_thread();
+                for (std::size_t i = 3; i > 0; --i) {
+                    recent[i] = recent[i - 1];
+                }
+                recent[0] = entry{id_, cache};
+                return *cache;
+            }
+
+            thread_cache* register_thread() {
+                static thread_local thread_exit exiting;
+
+                std::lock_guard<std::mutex> lock(core_->mutex);
+                std::unique_ptr<thread_cache>& cache = core_->caches[std::this_thread::get_id()];
+                if (!cache) {
+                    cache = std::make_unique<thread_cache>();
+                    /*Pools destroyed since are forgotten here*/
+                    exiting.caches.erase(std::remove_if(exiting.caches.begin(), exiting.caches.end(),
+                                                        [](const auto& entry) { return entry.first.expired(); }),
+                                         exiting.caches.end());
+                    exiting.caches.emplace_back(core_, cache.get());
+                }
+                return cache.get();
+            }
+
+            /*A batch from the shared list, else carved from the current slab*/
+            void refill(thread_cache& cache) {
+                std::lock_guard<std::mutex> lock(core_->mutex);
+                while (cache.items.size < cache_batch) {
+                    slot* item = core_->shared.pop();
+                    if (item == nullptr) {
+                        if (core_->carved == slab_objects) {
+                            core_->slabs.emplace_back(new slot[slab_objects]);
+                            core_->carved = 0;
+                        }
+                        item = &core_->slabs.back()[core_->carved++];
+                    }
+                    cache.items.push(item);
+                }
+            }
+
+            void spill(thread_cache& cache) {
+                std::lock_guard<std::mutex> lock(core_->mutex);
+                while (cache.items.size > cache_batch) {
+                    core_->shared.push(cache.items.pop());
+                }
+            }
+
+            const std::uint64_t id_;
+            std::shared_ptr<core> core_;
+    };
+}
+
+#endif
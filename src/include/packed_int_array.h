@@ -0,0 +1,170 @@
+#ifndef INCLUDE_PACKED_INT_ARRAY_H
+#define INCLUDE_PACKED_INT_ARRAY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "type_trait.h"
+
+namespace containers {
+    using namespace miscellaneous_transformation;
+
+    /*
+     * Array of unsigned Bits-bit integers stored back to back.
+     * Value i starts at bit i * Bits; reads and writes are one unaligned 64-bit
+     * load (and store) shifted by the bit offset, which is why Bits stops at 56.
+     * Note : the layout is little-endian.
+     */
+    template<std::size_t Bits>
+    class packed_int_array {
+        static_assert(Bits >= 1 && Bits <= 56, "packed_int_array supports 1 to 56 bits");
+        static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "packed_int_array needs a little-endian target");
+
+        public:
+            static constexpr std::uint64_t max_value = (std::uint64_t(1) << Bits) - 1;
+
+            using value_type = uint_least_for_t<max_value>;
+            using size_type = std::size_t;
+
+            packed_int_array() = default;
+
+            explicit packed_int_array(size_type count) { resize(count); }
+
+            void resize(size_type count) {
+                if (count < size_) {
+                    /*Bits past the new end read as zeros once the array grows again*/
+                    size_type bit = count * Bits;
+                    words_[bit / 64] &= (std::uint64_t(1) << (bit % 64)) - 1;
+                    std::fill(words_.begin() + static_cast<std::ptrdiff_t>(bit / 64 + 1), words_.end(), 0);
+                }
+                size_ = count;
+                /*One spare word, so the 64-bit load of the last value stays in bounds*/
+                words_.resize((count * Bits + 63) / 64 + 1);
+            }
+
+            size_type size() const noexcept { return size_; }
+
+            size_type memory_bytes() const noexcept { return words_.size() * sizeof(std::uint64_t); }
+
+            value_type get(size_type index) const noexcept {
+                size_type bit = index * Bits;
+                return static_cast<value_type>((load(bit / 8) >> (bit % 8)) & max_value);
+            }
+
+            void set(size_type index, value_type value) noexcept {
+                size_type bit = index * Bits;
+                std::uint64_t word = load(bit / 8);
+                word &= ~(max_value << (bit % 8));
+                word |= (static_cast<std::uint64_t>(value) & max_value) << (bit % 8);
+                store(bit / 8, word);
+            }
+
+            /*out[k] = get(first + k) for k < count, eight values per step*/
+            void unpack(size_type first, size_type count, value_type* out) const noexcept {
+                size_type index = first;
+                size_type last = first + count;
+                for (; index < last && index % 8 != 0; ++index) {
+                    *out++ = get(index);
+                }
+                /*Eight values span exactly Bits bytes, their offsets inside the block are constants*/
+                for (; index + 8 <= last; index += 8, out += 8) {
+                    unpack_block(bytes() + index / 8 * Bits, out, std::make_index_sequence<8>{});
+                }
+                for (; index < last; ++index) {
+                    *out++ = get(index);
+                }
+            }
+
+            /*set(first + k, in[k]) for k < count, whole blocks of eight written a word at a time*/
+            void pack(size_type first, size_type count, const value_type* in) noexcept {
+                size_type index = first;
+                size_type last = first + count;
+                for (; index < last && index % 8 != 0; ++index) {
+                    set(index, *in++);
+                }
+                for (; index + 8 <= last; index += 8, in += 8) {
+                    pack_block(reinterpret_cast<unsigned char*>(words_.data()) + index / 8 * Bits, in);
+                }
+                for (; index < last; ++index) {
+                    set(index, *in++);
+                }
+            }
+
+        private:
+            const unsigned char* bytes() const noexcept {
+                return reinterpret_cast<const unsigned char*>(words_.data());
+            }
+
+            std::uint64_t load(size_type byte) const noexcept {
+                std::uint64_t word;
+                std::memcpy(&word, bytes() + byte, sizeof(word));
+                return word;
+            }
+
+            void store(size_type byte, std::uint64_t word) noexcept {
+                std::memcpy(reinterpret_cast<unsigned char*>(words_.data()) + byte, &word, sizeof(word));
+            }
+
+            static std::uint64_t load_at(const unsigned char* p) noexcept {
+                std::uint64_t word;
+                std::memcpy(&word, p, sizeof(word));
+                return word;
+            }
+
+            /*The Bits bytes of a block belong to its eight values only : no read-modify-write*/
+            static void pack_block(unsigned char* block, const value_type* in) noexcept {
+                std::uint64_t word = 0;
+                std::size_t filled = 0;
+                for (std::size_t j = 0; j < 8; ++j) {
+                    std::uint64_t value = static_cast<std::uint64_t>(in[j]) & max_value;
+                    word |= value << filled;
+                    if (filled + Bits >= 64) {
+                        std::memcpy(block, &word, sizeof(word));
+                        block += sizeof(word);
+                        word = value >> (64 - filled);
+                        filled = filled + Bits - 64;
+                    } else {
+                        filled += Bits;
+                    }
+                }
+                std::memcpy(block, &word, filled / 8);
+            }
+
+            template<std::size_t... Js>
+            static void unpack_block(const unsigned char* block, value_type* out, std::index_sequence<Js...>) noexcept {
+#if defined(__AVX2__)
+                /*Four lanes per vector : gathered by unaligned loads, shifted by per-lane constants*/
+                const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(max_value));
+                alignas(32) std::uint64_t lanes[8];
+                for (std::size_t half = 0; half < 2; ++half) {
+                    std::size_t j = half * 4;
+                    __m256i words = _mm256_set_epi64x(
+                        static_cast<long long>(load_at(block + (j + 3) * Bits / 8)),
+                        static_cast<long long>(load_at(block + (j + 2) * Bits / 8)),
+                        static_cast<long long>(load_at(block + (j + 1) * Bits / 8)),
+                        static_cast<long long>(load_at(block + j * Bits / 8)));
+                    __m256i shifts = _mm256_set_epi64x((j + 3) * Bits % 8, (j + 2) * Bits % 8,
+                                                       (j + 1) * Bits % 8, j * Bits % 8);
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes + j),
+                                       _mm256_and_si256(_mm256_srlv_epi64(words, shifts), mask));
+                }
+                ((out[Js] = static_cast<value_type>(lanes[Js])), ...);
+#else
+                ((out[Js] = static_cast<value_type>((load_at(block + Js * Bits / 8) >> (Js * Bits % 8)) & max_value)), ...);
+#endif
+            }
+
+            std::vector<std::uint64_t> words_ = std::vector<std::uint64_t>(1);
+            size_type size_ = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,245 @@
+#ifndef INCLUDE_PERFECT_HASH_H
+#define INCLUDE_PERFECT_HASH_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "type_trait.h"
+
+/*Compile-time perfect hashing (hash, displace and compress)*/
+namespace perfect_hash {
+    namespace detail {
+        constexpr std::size_t next_pow2(std::size_t n) noexcept {
+            std::size_t p = 1;
+            while (p < n) {
+                p <<= 1;
+            }
+            return p;
+        }
+
+        /*Splitting one 64-bit hash into bucket, first and second probe*/
+        constexpr std::uint32_t first(std::uint64_t h) noexcept {
+            return static_cast<std::uint32_t>(h);
+        }
+
+        /*Odd step, so that one displacement walks every slot of a power of two table*/
+        constexpr std::uint32_t second(std::uint64_t h) noexcept {
+            return static_cast<std::uint32_t>((h >> 32) ^ (h >> 13)) | 1u;
+        }
+
+        constexpr std::size_t bucket(std::uint64_t h, std::size_t mask) noexcept {
+            return static_cast<std::size_t>(h >> 40) & mask;
+        }
+
+        /*Little-endian load, byte by byte while constant evaluating*/
+        template<typename U>
+        constexpr U load(const char* p) noexcept {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            if (!constant_evaluation_context::is_constant_evaluated()) {
+                U w = 0;
+                std::memcpy(&w, p, sizeof(U));
+                return w;
+            }
+#endif
+            U w = 0;
+            for (std::size_t i = 0; i < sizeof(U); ++i) {
+                w |= static_cast<U>(static_cast<unsigned char>(p[i])) << (8 * i);
+            }
+            return w;
+        }
+
+        /*The last n < 8 bytes, without reading past the end*/
+        constexpr std::uint64_t load_tail(const char* p, std::size_t n) noexcept {
+            if (n >= 4) {
+                return load<std::uint32_t>(p) | static_cast<std::uint64_t>(load<std::uint32_t>(p + n - 4)) << 32;
+            }
+            if (n > 0) {
+                return static_cast<std::uint64_t>(static_cast<unsigned char>(p[0])) |
+                       static_cast<std::uint64_t>(static_cast<unsigned char>(p[n / 2])) << 8 |
+                       static_cast<std::uint64_t>(static_cast<unsigned char>(p[n - 1])) << 16;
+            }
+            return 0;
+        }
+
+        constexpr std::uint64_t fmix(std::uint64_t h) noexcept {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ull;
+            return h ^ (h >> 33);
+        }
+
+        /*Seed 0 keeps the key hash as it is, so most tables never pay the extra mix*/
+        constexpr std::uint64_t reseed(std::uint64_t h, std::uint64_t seed) noexcept {
+            return seed == 0 ? h : fmix(h ^ seed);
+        }
+    }
+
+    /*Word at a time, usable both in constant evaluation and at runtime*/
+    constexpr std::uint64_t hash_bytes(std::string_view s) noexcept {
+        const char* p = s.data();
+        std::size_t n = s.size();
+        std::uint64_t h = 0x9e3779b97f4a7c15ull ^ (n * 0x100000001b3ull);
+        while (n >= 8) {
+            h = (h ^ detail::load<std::uint64_t>(p)) * 0x87c37b91114253d5ull;
+            h = (h << 31) | (h >> 33);
+            p += 8;
+            n -= 8;
+        }
+        h ^= detail::load_tail(p, n);
+        return detail::fmix(h);
+    }
+
+    constexpr std::uint64_t hash_integer(std::uint64_t x) noexcept {
+        x += 0x9e3779b97f4a7c15ull;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        return x ^ (x >> 31);
+    }
+
+    /*
+     * Maps N distinct 64-bit key hashes onto [0, N) without collisions.
+     * find() costs one displacement load and one slot load, the caller still
+     * has to compare the key stored at the returned index.
+     * Key hashes are mixed with seed first, the one make_chd settled on.
+     */
+    template<std::size_t N>
+    struct chd_table {
+        static constexpr std::size_t slot_count = detail::next_pow2(N + N / 4 + 1);
+        static constexpr std::size_t bucket_count = detail::next_pow2((N + 3) / 4 + 1);
+        static_assert(slot_count <= 0x10000, "perfect_hash: too many keys");
+
+        /*(d0 << 16) | d1 for every bucket*/
+        std::array<std::uint32_t, bucket_count> displacement{};
+        /*Key index for every slot, N for an empty slot*/
+        std::array<std::size_t, slot_count> slots{};
+        std::uint64_t seed = 0;
+        bool valid = false;
+
+        constexpr std::size_t find(std::uint64_t key_hash) const noexcept {
+            std::uint64_t h = detail::reseed(key_hash, seed);
+            std::uint32_t d = displacement[detail::bucket(h, bucket_count - 1)];
+            std::uint32_t slot = detail::first(h) + (d >> 16) * detail::second(h) + (d & 0xffffu);
+            return slots[slot & (slot_count - 1)];
+        }
+    };
+
+    namespace detail {
+        /*
+         * Places every bucket of the seeded hashes, false when one cannot be placed.
+         * Two keys of a bucket whose first and second probes agree modulo slot_count
+         * collide for every displacement : that bucket needs another seed.
+         */
+        template<std::size_t N>
+        constexpr bool place(const std::array<std::uint64_t, N>& hashes, chd_table<N>& table) noexcept {
+            using table_t = chd_table<N>;
+            constexpr std::size_t slot_mask = table_t::slot_count - 1;
+            constexpr std::size_t bucket_mask = table_t::bucket_count - 1;
+
+            for (std::size_t i = 0; i < N; ++i) {
+                for (std::size_t j = i + 1; j < N; ++j) {
+                    if (bucket(hashes[i], bucket_mask) == bucket(hashes[j], bucket_mask) &&
+                        ((first(hashes[i]) ^ first(hashes[j])) & slot_mask) == 0 &&
+                        ((second(hashes[i]) ^ second(hashes[j])) & slot_mask) == 0) {
+                        return false;
+                    }
+                }
+            }
+
+            for (std::size_t s = 0; s < table_t::slot_count; ++s) {
+                table.slots[s] = N;
+            }
+
+            std::array<std::size_t, table_t::bucket_count> bucket_size{};
+            for (std::size_t i = 0; i < N; ++i) {
+                ++bucket_size[bucket(hashes[i], bucket_mask)];
+            }
+
+            /*Place the largest buckets first, they are the hardest to fit*/
+            std::array<std::size_t, table_t::bucket_count> order{};
+            for (std::size_t b = 0; b < table_t::bucket_count; ++b) {
+                std::size_t j = b;
+                while (j > 0 && bucket_size[order[j - 1]] < bucket_size[b]) {
+                    order[j] = order[j - 1];
+                    --j;
+                }
+                order[j] = b;
+            }
+
+            for (std::size_t b : order) {
+                if (bucket_size[b] == 0) {
+                    break;
+                }
+
+                bool placed = false;
+                for (std::uint32_t d0 = 0; d0 < table_t::slot_count && !placed; ++d0) {
+                    for (std::uint32_t d1 = 0; d1 < table_t::slot_count && !placed; ++d1) {
+                        std::array<std::size_t, N> taken{};
+                        std::size_t count = 0;
+                        bool ok = true;
+                        for (std::size_t i = 0; i < N && ok; ++i) {
+                            if (bucket(hashes[i], bucket_mask) != b) {
+                                continue;
+                            }
+                            std::size_t slot = (first(hashes[i]) + d0 * second(hashes[i]) + d1) & slot_mask;
+                            if (table.slots[slot] != N) {
+                                ok = false;
+                            }
+                            for (std::size_t k = 0; k < count && ok; ++k) {
+                                if (taken[k] == slot) {
+                                    ok = false;
+                                }
+                            }
+                            taken[count++] = slot;
+                        }
+                        if (!ok) {
+                            continue;
+                        }
+
+                        count = 0;
+                        for (std::size_t i = 0; i < N; ++i) {
+                            if (bucket(hashes[i], bucket_mask) == b) {
+                                table.slots[taken[count++]] = i;
+                            }
+                        }
+                        table.displacement[b] = (d0 << 16) | d1;
+                        placed = true;
+                    }
+                }
+                if (!placed) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    /*
+     * Retries with a new seed mixed into every key hash until each bucket fits.
+     * Only keys sharing the full 64-bit hash (duplicates included) exhaust the seeds.
+     */
+    template<std::size_t N>
+    constexpr chd_table<N> make_chd(const std::array<std::uint64_t, N>& hashes) noexcept {
+        constexpr std::uint64_t max_seeds = 64;
+
+        for (std::uint64_t attempt = 0; attempt < max_seeds; ++attempt) {
+            chd_table<N> table{};
+            table.seed = attempt == 0 ? 0 : hash_integer(attempt);
+
+            std::array<std::uint64_t, N> seeded{};
+            for (std::size_t i = 0; i < N; ++i) {
+                seeded[i] = detail::reseed(hashes[i], table.seed);
+            }
+            if (detail::place(seeded, table)) {
+                table.valid = true;
+                return table;
+            }
+        }
+        return chd_table<N>{};
+    }
+}
+
+#endif
@@ -0,0 +1,236 @@
+#ifndef INCLUDE_RING_BUFFER_H
+#define INCLUDE_RING_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "type_trait.h"
+#include "atomic_storage.h"
+
+namespace concurrency {
+    /*Payloads a ring buffer keeps as raw bytes and moves with plain stores*/
+    template<typename T>
+    struct is_register_payload : public bool_constant<
+                                        is_trivially_copyable_v<T> &&
+                                        sizeof(T) <= sizeof(void*)> { };
+
+    template<typename T>
+    inline constexpr bool is_register_payload_v = is_register_payload<T>::value;
+
+    template<typename T>
+    struct inline_slot {
+        template<typename... Args>
+        void construct(Args&&... args) {
+            T value(std::forward<Args>(args)...);
+            std::memcpy(storage, &value, sizeof(T));
+        }
+
+        void take(T& out) noexcept {
+            std::memcpy(&out, storage, sizeof(T));
+        }
+
+        void destroy() noexcept { }
+
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    template<typename T>
+    struct constructed_slot {
+        template<typename... Args>
+        void construct(Args&&... args) {
+            ::new (static_cast<void*>(storage)) T(std::forward<Args>(args)...);
+        }
+
+        void take(T& out) {
+            T* value = std::launder(reinterpret_cast<T*>(storage));
+            out = std::move(*value);
+            value->~T();
+        }
+
+        void destroy() noexcept {
+            std::launder(reinterpret_cast<T*>(storage))->~T();
+        }
+
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    template<typename T>
+    using ring_slot = conditional_t<is_register_payload_v<T>, inline_slot<T>, constructed_slot<T>>;
+
+    /*Bounded single-producer single-consumer queue, Capacity must be a power of two*/
+    template<typename T, std::size_t Capacity>
+    class spsc_ring_buffer {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+        public:
+            spsc_ring_buffer() : slots_(new ring_slot<T>[Capacity]) { }
+
+            spsc_ring_buffer(const spsc_ring_buffer&) = delete;
+            spsc_ring_buffer& operator=(const spsc_ring_buffer&) = delete;
+
+            ~spsc_ring_buffer() {
+                std::size_t tail = tail_.load(std::memory_order_relaxed);
+                for (std::size_t i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+                    slots_[i & mask].destroy();
+                }
+            }
+
+            template<typename... Args>
+            bool try_emplace(Args&&... args) {
+                std::size_t tail = tail_.load(std::memory_order_relaxed);
+                if (tail - cached_head_ == Capacity) {
+                    cached_head_ = head_.load(std::memory_order_acquire);
+                    if (tail - cached_head_ == Capacity) {
+                        return false;
+                    }
+                }
+                slots_[tail & mask].construct(std::forward<Args>(args)...);
+                tail_.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+
+            bool try_push(const T& value) { return try_emplace(value); }
+
+            bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+            bool try_pop(T& out) {
+                std::size_t head = head_.load(std::memory_order_relaxed);
+                if (head == cached_tail_) {
+                    cached_tail_ = tail_.load(std::memory_order_acquire);
+                    if (head == cached_tail_) {
+                        return false;
+                    }
+                }
+                slots_[head & mask].take(out);
+                head_.store(head + 1, std::memory_order_release);
+                return true;
+            }
+
+            static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+        private:
+            static constexpr std::size_t mask = Capacity - 1;
+
+            /*Consumer line*/
+            alignas(cache_line_size) std::atomic<std::size_t> head_{0};
+            std::size_t cached_tail_ = 0;
+            /*Producer line*/
+            alignas(cache_line_size) std::atomic<std::size_t> tail_{0};
+            std::size_t cached_head_ = 0;
+
+            alignas(cache_line_size) std::unique_ptr<ring_slot<T>[]> slots_;
+    };
+
+    /*Bounded multi-producer multi-consumer queue (Vyukov), Capacity must be a power of two*/
+    template<typename T, std::size_t Capacity>
+    class mpmc_ring_buffer {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+        public:
+            mpmc_ring_buffer() : cells_(new cell[Capacity]) {
+                for (std::size_t i = 0; i < Capacity; ++i) {
+                    cells_[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            mpmc_ring_buffer(const mpmc_ring_buffer&) = delete;
+            mpmc_ring_buffer& operator=(const mpmc_ring_buffer&) = delete;
+
+            ~mpmc_ring_buffer() {
+                std::size_t tail = tail_.load(std::memory_order_relaxed);
+                for (std::size_t i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+                    cells_[i & mask].slot.destroy();
+                }
+            }
+
+            /*
+             * A claimed cell must be published, or the queue stalls on it : a constructor
+             * that may throw runs on a temporary before the claim, moved in after it.
+             */
+            template<typename... Args>
+            bool try_emplace(Args&&... args) {
+                if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+                    return emplace_claimed(std::forward<Args>(args)...);
+                } else {
+                    static_assert(std::is_nothrow_move_constructible_v<T>,
+                                  "mpmc_ring_buffer needs a nothrow constructor or a nothrow move constructor");
+                    T value(std::forward<Args>(args)...);
+                    return emplace_claimed(std::move(value));
+                }
+            }
+
+            bool try_push(const T& value) { return try_emplace(value); }
+
+            bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+            /*The cell is claimed before take() : a throwing move assignment would stall the queue*/
+            bool try_pop(T& out) {
+                static_assert(std::is_nothrow_move_assignable_v<T>, "mpmc_ring_buffer needs a nothrow move assignment");
+
+                std::size_t position = head_.load(std::memory_order_relaxed);
+                cell* source;
+                for (;;) {
+                    source = &cells_[position & mask];
+                    std::size_t sequence = source->sequence.load(std::memory_order_acquire);
+                    std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+                    if (diff == 0) {
+                        if (head_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                            break;
+                        }
+                    } else if (diff < 0) {
+                        return false;
+                    } else {
+                        position = head_.load(std::memory_order_relaxed);
+                    }
+                }
+                source->slot.take(out);
+                source->sequence.store(position + Capacity, std::memory_order_release);
+                return true;
+            }
+
+            static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+        private:
+            static constexpr std::size_t mask = Capacity - 1;
+
+            template<typename... Args>
+            bool emplace_claimed(Args&&... args) noexcept {
+                std::size_t position = tail_.load(std::memory_order_relaxed);
+                cell* target;
+                for (;;) {
+                    target = &cells_[position & mask];
+                    std::size_t sequence = target->sequence.load(std::memory_order_acquire);
+                    std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+                    if (diff == 0) {
+                        if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                            break;
+                        }
+                    } else if (diff < 0) {
+                        return false;
+                    } else {
+                        position = tail_.load(std::memory_order_relaxed);
+                    }
+                }
+                target->slot.construct(std::forward<Args>(args)...);
+                target->sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+
+            struct cell {
+                std::atomic<std::size_t> sequence;
+                ring_slot<T> slot;
+            };
+
+            alignas(cache_line_size) std::atomic<std::size_t> head_{0};
+            alignas(cache_line_size) std::atomic<std::size_t> tail_{0};
+            alignas(cache_line_size) std::unique_ptr<cell[]> cells_;
+    };
+}
+
+#endif
@@ -0,0 +1,195 @@
+#ifndef INCLUDE_SOA_VECTOR_H
+#define INCLUDE_SOA_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "type_trait.h"
+
+namespace containers {
+    using namespace members_relationships;
+
+    /*One byte per bool : std::vector<bool> packs bits and hands out proxies, not bool&*/
+    struct bool_cell {
+        bool_cell(bool value = false) noexcept : value(value) { }
+
+        bool value;
+    };
+
+    namespace detail {
+        template<typename F>
+        struct column_element {
+            using type = F;
+        };
+
+        template<>
+        struct column_element<bool> {
+            using type = bool_cell;
+        };
+
+        template<typename F>
+        using column_element_t = typename column_element<F>::type;
+
+        template<typename F>
+        constexpr F& field_of(F& element) noexcept { return element; }
+
+        constexpr bool& field_of(bool_cell& element) noexcept { return element.value; }
+
+        constexpr const bool& field_of(const bool_cell& element) noexcept { return element.value; }
+    }
+
+    /*
+     * Struct-of-arrays vector of an aggregate T : field I of every element lives in
+     * its own contiguous std::vector, so a scan over one field touches only that field.
+     * Elements are accessed through a proxy of references to their fields.
+     * A push_back or resize that throws leaves every column at its previous size.
+     */
+    template<typename T>
+    class soa_vector {
+        static_assert(is_aggregate_v<T>, "soa_vector needs an aggregate");
+        static_assert(field_count_v<T> > 0, "soa_vector needs at least one field");
+
+        private:
+            static constexpr std::size_t fields = field_count_v<T>;
+            using indices = std::make_index_sequence<fields>;
+
+            template<typename Sequence>
+            struct columns_for;
+
+            template<std::size_t... Is>
+            struct columns_for<std::index_sequence<Is...>> {
+                using type = std::tuple<std::vector<detail::column_element_t<field_t<T, Is>>>...>;
+                using reference = std::tuple<field_t<T, Is>&...>;
+                using const_reference = std::tuple<const field_t<T, Is>&...>;
+            };
+
+        public:
+            using value_type = T;
+            using size_type = std::size_t;
+
+            template<typename Fields>
+            class basic_reference {
+                public:
+                    explicit basic_reference(Fields fields) noexcept : fields_(fields) { }
+
+                    template<std::size_t I>
+                    decltype(auto) get() const noexcept { return std::get<I>(fields_); }
+
+                    operator T() const {
+                        return std::apply([](const auto&... fields) { return T{fields...}; }, fields_);
+                    }
+
+                    const basic_reference& operator=(const T& value) const {
+                        assign(tie_fields(value), indices{});
+                        return *this;
+                    }
+
+                private:
+                    template<typename Source, std::size_t... Is>
+                    void assign(const Source& source, std::index_sequence<Is...>) const {
+                        ((std::get<Is>(fields_) = std::get<Is>(source)), ...);
+                    }
+
+                    Fields fields_;
+            };
+
+            using reference = basic_reference<typename columns_for<indices>::reference>;
+            using const_reference = basic_reference<typename columns_for<indices>::const_reference>;
+
+            template<typename Reference, typename Owner>
+            class basic_iterator {
+                public:
+                    basic_iterator(Owner* owner, size_type index) noexcept : owner_(owner), index_(index) { }
+
+                    Reference operator*() const { return (*owner_)[index_]; }
+
+                    basic_iterator& operator++() noexcept {
+                        ++index_;
+                        return *this;
+                    }
+
+                    bool operator==(const basic_iterator& other) const noexcept { return index_ == other.index_; }
+
+                    bool operator!=(const basic_iterator& other) const noexcept { return index_ != other.index_; }
+
+                private:
+                    Owner* owner_;
+                    size_type index_;
+            };
+
+            using iterator = basic_iterator<reference, soa_vector>;
+            using const_iterator = basic_iterator<const_reference, const soa_vector>;
+
+            void push_back(const T& value) {
+                push_back(value, indices{});
+            }
+
+            void reserve(size_type capacity) {
+                std::apply([capacity](auto&... columns) { (columns.reserve(capacity), ...); }, columns_);
+            }
+
+            void resize(size_type count) {
+                size_type previous = size();
+                try {
+                    std::apply([count](auto&... columns) { (columns.resize(count), ...); }, columns_);
+                } catch (...) {
+                    std::apply([previous](auto&... columns) { (columns.resize(std::min(columns.size(), previous)), ...); }, columns_);
+                    throw;
+                }
+            }
+
+            void clear() noexcept {
+                std::apply([](auto&... columns) { (columns.clear(), ...); }, columns_);
+            }
+
+            size_type size() const noexcept { return std::get<0>(columns_).size(); }
+
+            bool empty() const noexcept { return size() == 0; }
+
+            reference operator[](size_type index) noexcept {
+                return at_index<reference>(*this, index, indices{});
+            }
+
+            const_reference operator[](size_type index) const noexcept {
+                return at_index<const_reference>(*this, index, indices{});
+            }
+
+            /*Contiguous storage of field I, a bool field as bool_cell*/
+            template<std::size_t I>
+            std::vector<detail::column_element_t<field_t<T, I>>>& column() noexcept { return std::get<I>(columns_); }
+
+            template<std::size_t I>
+            const std::vector<detail::column_element_t<field_t<T, I>>>& column() const noexcept { return std::get<I>(columns_); }
+
+            iterator begin() noexcept { return iterator(this, 0); }
+            iterator end() noexcept { return iterator(this, size()); }
+            const_iterator begin() const noexcept { return const_iterator(this, 0); }
+            const_iterator end() const noexcept { return const_iterator(this, size()); }
+
+        private:
+            /*Columns pushed before a throw give their element back*/
+            template<std::size_t... Is>
+            void push_back(const T& value, std::index_sequence<Is...>) {
+                auto fields = tie_fields(value);
+                size_type previous = size();
+                try {
+                    (std::get<Is>(columns_).push_back(std::get<Is>(fields)), ...);
+                } catch (...) {
+                    ((std::get<Is>(columns_).size() > previous ? std::get<Is>(columns_).pop_back() : void()), ...);
+                    throw;
+                }
+            }
+
+            template<typename Reference, typename Self, std::size_t... Is>
+            static Reference at_index(Self& self, size_type index, std::index_sequence<Is...>) noexcept {
+                return Reference(std::tie(detail::field_of(std::get<Is>(self.columns_)[index])...));
+            }
+
+            typename columns_for<indices>::type columns_;
+    };
+}
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef INCLUDE_STATIC_MAP_H
+#define INCLUDE_STATIC_MAP_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include "type_trait.h"
+#include "perfect_hash.h"
+
+/*Fixed-size containers*/
+namespace containers {
+    using namespace type_categories;
+    using namespace miscellaneous_transformation;
+
+    /*Integral and enum keys hash their value, every other key is viewed as a string*/
+    template<typename Key, bool = is_integral_v<remove_cv_t<Key>> || is_enum_v<Key>>
+    struct static_map_key {
+        using lookup_type = Key;
+
+        static constexpr std::uint64_t hash(Key key) noexcept {
+            return perfect_hash::hash_integer(static_cast<std::uint64_t>(key));
+        }
+
+        static constexpr bool equal(Key lhs, Key rhs) noexcept {
+            return lhs == rhs;
+        }
+    };
+
+    template<typename Key>
+    struct static_map_key<Key, false> {
+        using lookup_type = std::string_view;
+
+        static constexpr std::uint64_t hash(std::string_view key) noexcept {
+            return perfect_hash::hash_bytes(key);
+        }
+
+        static constexpr bool equal(std::string_view lhs, std::string_view rhs) noexcept {
+            return lhs == rhs;
+        }
+    };
+
+    /*
+     * Immutable map whose perfect hash is built while constant evaluating.
+     * A lookup is one hash, one slot load and one key compare.
+     *
+     *     constexpr auto opcodes = make_static_map<std::string_view, int>({{"add", 1}, {"sub", 2}});
+     */
+    template<typename Key, typename Value, std::size_t N>
+    class static_map {
+        private:
+            using key_traits = static_map_key<Key>;
+            using lookup_type = typename key_traits::lookup_type;
+
+        public:
+            using key_type = Key;
+            using mapped_type = Value;
+            using value_type = std::pair<Key, Value>;
+            using const_iterator = const value_type*;
+
+            constexpr explicit static_map(const value_type (&entries)[N])
+                : static_map(entries, std::make_index_sequence<N>{}) { }
+
+            constexpr const Value* find(lookup_type key) const noexcept {
+                std::size_t i = table_.find(key_traits::hash(key));
+                if (i < N && key_traits::equal(entries_[i].first, key)) {
+                    return &entries_[i].second;
+                }
+                return nullptr;
+            }
+
+            constexpr bool contains(lookup_type key) const noexcept {
+                return find(key) != nullptr;
+            }
+
+            constexpr const Value& at(lookup_type key) const {
+                const Value* value = find(key);
+                if (value == nullptr) {
+                    throw std::out_of_range("static_map::at: unknown key");
+                }
+                return *value;
+            }
+
+            constexpr std::size_t size() const noexcept { return N; }
+
+            constexpr const_iterator begin() const noexcept { return entries_.data(); }
+
+            constexpr const_iterator end() const noexcept { return entries_.data() + N; }
+
+        private:
+            template<std::size_t... Is>
+            constexpr static_map(const value_type (&entries)[N], std::index_sequence<Is...>)
+                : entries_{{entries[Is]...}},
+                  table_(perfect_hash::make_chd(std::array<std::uint64_t, N>{{key_traits::hash(entries[Is].first)...}})) {
+                /*A throw while constant evaluating turns into a compile error*/
+                if (!table_.valid) {
+                    throw std::invalid_argument("static_map: duplicate keys, or keys with the same 64-bit hash");
+                }
+            }
+
+            std::array<value_type, N> entries_;
+            perfect_hash::chd_table<N> table_;
+    };
+
+    template<typename Key, typename Value, std::size_t N>
+    static_map(const std::pair<Key, Value> (&)[N]) -> static_map<Key, Value, N>;
+
+    template<typename Key, typename Value, std::size_t N>
+    constexpr static_map<Key, Value, N> make_static_map(const std::pair<Key, Value> (&entries)[N]) {
+        return static_map<Key, Value, N>(entries);
+    }
+}
+
+#endif
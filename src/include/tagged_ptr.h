@@ -0,0 +1,137 @@
+#ifndef INCLUDE_TAGGED_PTR_H
+#define INCLUDE_TAGGED_PTR_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "type_trait.h"
+#include "constexpr_math.h"
+
+namespace concurrency {
+    using namespace pointers;
+    using namespace property_queries;
+
+    /*
+     * Pointer to T with a TagBits-bit tag kept in the low bits that alignof(T) leaves at zero.
+     * T may be given as the pointee or as the pointer type : tagged_ptr<Node, 2> == tagged_ptr<Node*, 2>.
+     * Note : the alignment is checked where the pointer is used and not in the class body,
+     * so a node may hold a tagged_ptr to its own, still incomplete, type.
+     */
+    template<typename T, std::size_t TagBits>
+    class tagged_ptr {
+        static_assert(TagBits >= 1, "tagged_ptr needs at least one tag bit");
+
+        public:
+            using element_type = remove_pointer_t<T>;
+            using pointer = element_type*;
+            using tag_type = std::uintptr_t;
+
+            static constexpr std::size_t tag_bits = TagBits;
+            static constexpr tag_type tag_mask = (tag_type(1) << TagBits) - 1;
+
+            constexpr tagged_ptr() noexcept = default;
+
+            tagged_ptr(pointer ptr, tag_type tag = 0) noexcept : bits_(pack(ptr, tag)) { }
+
+            /*Bit pattern as stored, what the atomic variant exchanges*/
+            static tagged_ptr from_bits(std::uintptr_t bits) noexcept {
+                tagged_ptr result;
+                result.bits_ = bits;
+                return result;
+            }
+
+            std::uintptr_t bits() const noexcept { return bits_; }
+
+            pointer get() const noexcept {
+                return reinterpret_cast<pointer>(bits_ & ~checked_mask());
+            }
+
+            tag_type tag() const noexcept { return bits_ & checked_mask(); }
+
+            void set(pointer ptr) noexcept { bits_ = pack(ptr, tag()); }
+
+            void set_tag(tag_type tag) noexcept { bits_ = (bits_ & ~checked_mask()) | (tag & tag_mask); }
+
+            /*Same pointer, tag + 1 wrapping at 2^TagBits : the ABA counter step*/
+            tagged_ptr next_tag(pointer ptr) const noexcept { return tagged_ptr(ptr, tag() + 1); }
+
+            pointer operator->() const noexcept { return get(); }
+
+            element_type& operator*() const noexcept { return *get(); }
+
+            explicit operator bool() const noexcept { return get() != nullptr; }
+
+            bool operator==(const tagged_ptr& other) const noexcept { return bits_ == other.bits_; }
+
+            bool operator!=(const tagged_ptr& other) const noexcept { return bits_ != other.bits_; }
+
+        private:
+            static constexpr tag_type checked_mask() noexcept {
+                static_assert(constexpr_math::log2(alignment_of_v<element_type>) >= static_cast<int>(TagBits),
+                              "tagged_ptr : alignof(T) leaves fewer free low bits than TagBits");
+                return tag_mask;
+            }
+
+            static std::uintptr_t pack(pointer ptr, tag_type tag) noexcept {
+                return reinterpret_cast<std::uintptr_t>(ptr) | (tag & checked_mask());
+            }
+
+            std::uintptr_t bits_ = 0;
+    };
+
+    /*
+     * tagged_ptr in one lock-free word : pointer and tag are read and swapped together,
+     * so a compare_exchange that bumps the tag fails on a pointer that was popped and pushed back (ABA).
+     * Note : the counter wraps after 2^TagBits updates, raise alignof(T) for a wider one.
+     */
+    template<typename T, std::size_t TagBits>
+    class atomic_tagged_ptr {
+        public:
+            using value_type = tagged_ptr<T, TagBits>;
+
+            static constexpr bool is_always_lock_free = std::atomic<std::uintptr_t>::is_always_lock_free;
+
+            atomic_tagged_ptr() noexcept = default;
+
+            explicit atomic_tagged_ptr(value_type value) noexcept : bits_(value.bits()) { }
+
+            atomic_tagged_ptr(const atomic_tagged_ptr&) = delete;
+            atomic_tagged_ptr& operator=(const atomic_tagged_ptr&) = delete;
+
+            value_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+                return value_type::from_bits(bits_.load(order));
+            }
+
+            void store(value_type value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                bits_.store(value.bits(), order);
+            }
+
+            value_type exchange(value_type value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                return value_type::from_bits(bits_.exchange(value.bits(), order));
+            }
+
+            bool compare_exchange_weak(value_type& expected, value_type desired,
+                                       std::memory_order success = std::memory_order_seq_cst,
+                                       std::memory_order failure = std::memory_order_seq_cst) noexcept {
+                std::uintptr_t bits = expected.bits();
+                bool exchanged = bits_.compare_exchange_weak(bits, desired.bits(), success, failure);
+                expected = value_type::from_bits(bits);
+                return exchanged;
+            }
+
+            bool compare_exchange_strong(value_type& expected, value_type desired,
+                                         std::memory_order success = std::memory_order_seq_cst,
+                                         std::memory_order failure = std::memory_order_seq_cst) noexcept {
+                std::uintptr_t bits = expected.bits();
+                bool exchanged = bits_.compare_exchange_strong(bits, desired.bits(), success, failure);
+                expected = value_type::from_bits(bits);
+                return exchanged;
+            }
+
+        private:
+            std::atomic<std::uintptr_t> bits_{0};
+    };
+}
+
+#endif
@@ -1,3 +1,19 @@
+#ifndef INCLUDE_TYPE_TRAIT_H
+#define INCLUDE_TYPE_TRAIT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/*Transformations below use the compiler's own when it has one, a flat specialization otherwise*/
+#if defined(__has_builtin)
+#define TYPE_TRAIT_HAS_BUILTIN(x) __has_builtin(x)
+#else
+#define TYPE_TRAIT_HAS_BUILTIN(x) 0
+#endif
+
 /*Helper classes*/
 
 template<typename T, T v>
@@ -43,18 +59,26 @@ namespace remove_const_volatile {
     template<typename T>
     using remove_volatile_t = typename remove_volatile<T>::type;
 
+#if TYPE_TRAIT_HAS_BUILTIN(__remove_cv)
+    //Note : __remove_cv is compiler feature
+    template<typename T>
+    struct remove_cv {
+        using type = __remove_cv(T);
+    };
+#else
+    /*One instantiation per type : no detour through remove_const and remove_volatile*/
     template<typename T>
     struct remove_cv {
         using type = T;
     };
 
     template<typename T>
-    struct remove_cv<T const> : public remove_const<T> {
+    struct remove_cv<T const> {
         using type = T;
     };
 
     template<typename T>
-    struct remove_cv<T volatile> : public remove_volatile<T> {
+    struct remove_cv<T volatile> {
         using type = T;
     };
 
@@ -62,6 +86,7 @@ namespace remove_const_volatile {
     struct remove_cv<T const volatile> {
         using type = T;
     };
+#endif
 
     template<typename T>
     using remove_cv_t = typename remove_cv<T>::type;
@@ -142,53 +167,77 @@ namespace type_categories{
     inline constexpr bool is_null_pointer_v = is_null_pointer<T>::value;
 
     template<typename T>
-    struct is_integral : public false_type { };
+    struct is_integral_helper : public false_type { };
 
     template<>
-    struct is_integral<bool> : public true_type { };
+    struct is_integral_helper<bool> : public true_type { };
 
     template<>
-    struct is_integral<char> : public true_type { };
+    struct is_integral_helper<char> : public true_type { };
 
 /* Since c++20
     template<>
-    struct is_integral<char8_t> : true_type { };
+    struct is_integral_helper<char8_t> : true_type { };
 */
     template<>
-    struct is_integral<char16_t> : public true_type { };
+    struct is_integral_helper<char16_t> : public true_type { };
 
     template<>
-    struct is_integral<char32_t> : public true_type { };
+    struct is_integral_helper<char32_t> : public true_type { };
 
     template<>
-    struct is_integral<wchar_t> : public true_type { };
+    struct is_integral_helper<wchar_t> : public true_type { };
 
     template<>
-    struct is_integral<short> : public true_type { };
+    struct is_integral_helper<short> : public true_type { };
 
     template<>
-    struct is_integral<int> : public true_type { };
+    struct is_integral_helper<int> : public true_type { };
 
     template<>
-    struct is_integral<long> : public true_type { };
+    struct is_integral_helper<long> : public true_type { };
 
     template<>
-    struct is_integral<long long> : public true_type { };
+    struct is_integral_helper<long long> : public true_type { };
+
+    template<>
+    struct is_integral_helper<signed char> : public true_type { };
+
+    template<>
+    struct is_integral_helper<unsigned char> : public true_type { };
+
+    template<>
+    struct is_integral_helper<unsigned short> : public true_type { };
+
+    template<>
+    struct is_integral_helper<unsigned int> : public true_type { };
+
+    template<>
+    struct is_integral_helper<unsigned long> : public true_type { };
+
+    template<>
+    struct is_integral_helper<unsigned long long> : public true_type { };
+
+    template<typename T>
+    struct is_integral : public is_integral_helper<remove_cv_t<T>> { };
 
     template<typename T>
     inline constexpr bool is_integral_v = is_integral<T>::value;
 
     template<typename T>
-    struct is_floating_point : public false_type { };
+    struct is_floating_point_helper : public false_type { };
 
     template<>
-    struct is_floating_point<float> : public true_type { };
+    struct is_floating_point_helper<float> : public true_type { };
 
     template<>
-    struct is_floating_point<double> : public true_type { };
+    struct is_floating_point_helper<double> : public true_type { };
 
     template<>
-    struct is_floating_point<long double> : public true_type { };
+    struct is_floating_point_helper<long double> : public true_type { };
+
+    template<typename T>
+    struct is_floating_point : public is_floating_point_helper<remove_cv_t<T>> { };
 
     template<typename T>
     inline constexpr bool is_floating_point_v = is_floating_point<T>::value;
@@ -541,14 +590,129 @@ namespace type_properties {
 
     template<typename T>
     inline constexpr bool is_unbounded_array_v = is_unbounded_array<T>::value;
+
+    //Note : __is_trivially_copyable is compiler feature
+    template<typename T>
+    struct is_trivially_copyable : public integral_constant<bool, __is_trivially_copyable(T)> { };
+
+    template<typename T>
+    inline constexpr bool is_trivially_copyable_v = is_trivially_copyable<T>::value;
+
+    //Note : __has_unique_object_representations is compiler feature
+    template<typename T>
+    struct has_unique_object_representations : public integral_constant<bool,
+                                                       __has_unique_object_representations(T)> { };
+
+    template<typename T>
+    inline constexpr bool has_unique_object_representations_v = has_unique_object_representations<T>::value;
+
+    //Note : __is_aggregate is compiler feature
+    template<typename T>
+    struct is_aggregate : public integral_constant<bool, __is_aggregate(T)> { };
+
+    template<typename T>
+    inline constexpr bool is_aggregate_v = is_aggregate<T>::value;
 }
 
 namespace supported_operations {
+    using namespace type_properties;
+
+    //Note : __is_constructible is compiler feature
+    template<typename T, typename... Args>
+    struct is_constructible : public integral_constant<bool, __is_constructible(T, Args...)> { };
 
+    template<typename T, typename... Args>
+    inline constexpr bool is_constructible_v = is_constructible<T, Args...>::value;
+
+    template<typename T>
+    struct is_default_constructible : public is_constructible<T> { };
+
+    template<typename T>
+    inline constexpr bool is_default_constructible_v = is_default_constructible<T>::value;
+
+    //Note : __is_trivially_constructible is compiler feature
+    template<typename T, typename... Args>
+    struct is_trivially_constructible : public integral_constant<bool, __is_trivially_constructible(T, Args...)> { };
+
+    template<typename T, typename... Args>
+    inline constexpr bool is_trivially_constructible_v = is_trivially_constructible<T, Args...>::value;
+
+    template<typename T>
+    struct is_trivially_default_constructible : public is_trivially_constructible<T> { };
+
+    template<typename T>
+    inline constexpr bool is_trivially_default_constructible_v = is_trivially_default_constructible<T>::value;
+
+    //Note : __is_assignable is compiler feature
+    template<typename T, typename U>
+    struct is_assignable : public integral_constant<bool, __is_assignable(T, U)> { };
+
+    template<typename T, typename U>
+    inline constexpr bool is_assignable_v = is_assignable<T, U>::value;
+
+    //Note : __is_trivially_assignable is compiler feature
+    template<typename T, typename U>
+    struct is_trivially_assignable : public integral_constant<bool, __is_trivially_assignable(T, U)> { };
+
+    template<typename T, typename U>
+    inline constexpr bool is_trivially_assignable_v = is_trivially_assignable<T, U>::value;
+
+    /*Object type whose destructor can be named, arrays by their element*/
+    template<typename T>
+    class is_destructible_helper {
+        private:
+            template<typename C, typename = decltype(std::declval<C&>().~C())>
+            static char test(int);
+
+            template<typename C>
+            static long test(...);
+
+        public:
+            static constexpr bool value = sizeof(test<T>(0)) == sizeof(char);
+    };
+
+    template<typename T, std::size_t N>
+    class is_destructible_helper<T[N]> : public is_destructible_helper<T> { };
+
+    template<typename T>
+    class is_destructible_helper<T[]> : public false_type { };
+
+    template<typename T>
+    class is_destructible_helper<T&> : public true_type { };
+
+    template<typename T>
+    class is_destructible_helper<T&&> : public true_type { };
+
+    template<typename T>
+    struct is_destructible : public integral_constant<bool, is_destructible_helper<T>::value> { };
+
+    template<typename T>
+    inline constexpr bool is_destructible_v = is_destructible<T>::value;
+
+#if TYPE_TRAIT_HAS_BUILTIN(__is_trivially_destructible)
+    //Note : __is_trivially_destructible is compiler feature
+    template<typename T>
+    struct is_trivially_destructible : public integral_constant<bool,
+                                                                is_destructible_v<T> &&
+                                                                __is_trivially_destructible(T)> { };
+#else
+    //Note : __has_trivial_destructor is compiler feature, deprecated by Clang in favour of the one above
+    template<typename T>
+    struct is_trivially_destructible : public integral_constant<bool,
+                                                                is_destructible_v<T> &&
+                                                                __has_trivial_destructor(T)> { };
+#endif
+
+    template<typename T>
+    inline constexpr bool is_trivially_destructible_v = is_trivially_destructible<T>::value;
 }
 
 namespace property_queries {
+    template<typename T>
+    struct alignment_of : public integral_constant<std::size_t, alignof(T)> { };
 
+    template<typename T>
+    inline constexpr std::size_t alignment_of_v = alignment_of<T>::value;
 }
 
 /*Reference*/
@@ -573,29 +737,72 @@ namespace references {
     template<typename T>
     using remove_reference_t = typename remove_reference<T>::type;
 
-    //template<typename T, bool B = is_reference_v<T>>
-    // struct add_lvalue_reference_helper {
-    //     using type = T;
-    // };
+    /*Every type but void and abominable function types (int() const) : T& is well-formed*/
+    template<typename T>
+    class is_referenceable {
+        private:
+            template<typename C, typename = C&>
+            static char test(int);
 
-    // template<typename T>
-    // struct add_lvalue_reference_helper<T, true> {
-    //     using type = T&;
-    // };
+            template<typename C>
+            static long test(...);
 
-    // template<typename T>
-    // struct add_lvalue_reference : struct add_lvalue_reference_helper { };
+        public:
+            static constexpr bool value = sizeof(test<T>(0)) == sizeof(char);
+    };
 
-    // template<typename T>
-    // using add_lvalue_reference_t = typename add_lvalue_reference<T>::type;
+    /*Reference collapsing gives U& for T = U& in both*/
+    template<typename T, bool = is_referenceable<T>::value>
+    struct add_reference_helper {
+        using lvalue = T;
+        using rvalue = T;
+    };
+
+    template<typename T>
+    struct add_reference_helper<T, true> {
+        using lvalue = T&;
+        using rvalue = T&&;
+    };
+
+#if TYPE_TRAIT_HAS_BUILTIN(__add_lvalue_reference)
+    //Note : __add_lvalue_reference is compiler feature
+    template<typename T>
+    struct add_lvalue_reference {
+        using type = __add_lvalue_reference(T);
+    };
+#else
+    template<typename T>
+    struct add_lvalue_reference {
+        using type = typename add_reference_helper<T>::lvalue;
+    };
+#endif
+
+    template<typename T>
+    using add_lvalue_reference_t = typename add_lvalue_reference<T>::type;
+
+#if TYPE_TRAIT_HAS_BUILTIN(__add_rvalue_reference)
+    //Note : __add_rvalue_reference is compiler feature
+    template<typename T>
+    struct add_rvalue_reference {
+        using type = __add_rvalue_reference(T);
+    };
+#else
+    template<typename T>
+    struct add_rvalue_reference {
+        using type = typename add_reference_helper<T>::rvalue;
+    };
+#endif
 
+    template<typename T>
+    using add_rvalue_reference_t = typename add_rvalue_reference<T>::type;
 }
 
 /*Pointer*/
 namespace pointers {
+    /*Not a pointer : left unchanged, as std::remove_pointer does*/
     template<typename T>
     struct remove_pointer {
-
+        using type = T;
     };
 
     template<typename T>
@@ -622,6 +829,46 @@ namespace pointers {
     // using remove_pointer_t = typename remove_pointer<T>::type;
     template<typename T>
     using remove_pointer_t = typename remove_pointer<T>::type;
+
+    /*Pointer to the referred type, abominable function types (int() const) unchanged*/
+    template<typename T>
+    class is_pointable {
+        private:
+            template<typename C, typename = references::remove_reference_t<C>*>
+            static char test(int);
+
+            template<typename C>
+            static long test(...);
+
+        public:
+            static constexpr bool value = sizeof(test<T>(0)) == sizeof(char);
+    };
+
+    template<typename T, bool = is_pointable<T>::value>
+    struct add_pointer_helper {
+        using type = T;
+    };
+
+    template<typename T>
+    struct add_pointer_helper<T, true> {
+        using type = references::remove_reference_t<T>*;
+    };
+
+#if TYPE_TRAIT_HAS_BUILTIN(__add_pointer)
+    //Note : __add_pointer is compiler feature
+    template<typename T>
+    struct add_pointer {
+        using type = __add_pointer(T);
+    };
+#else
+    template<typename T>
+    struct add_pointer {
+        using type = typename add_pointer_helper<T>::type;
+    };
+#endif
+
+    template<typename T>
+    using add_pointer_t = typename add_pointer<T>::type;
 }
 
 namespace sign_modifiers {
@@ -647,6 +894,18 @@ namespace arrays {
     template<typename T>
     using remove_extent_t = typename remove_extent<T>::type;
 
+#if TYPE_TRAIT_HAS_BUILTIN(__remove_all_extents)
+    //Note : __remove_all_extents is compiler feature
+    template<typename T>
+    struct remove_all_extents {
+        using type = __remove_all_extents(T);
+    };
+#else
+    /*
+     * Up to four extents peeled per step, the most specialized match wins :
+     * a rank-N array takes about N / 4 instantiations instead of N.
+     * Only the outermost extent can be unknown, it is peeled alone.
+     */
     template<typename T>
     struct remove_all_extents {
         using type = T;
@@ -655,14 +914,28 @@ namespace arrays {
     template<typename T>
     struct remove_all_extents<T[]> {
         using type = typename remove_all_extents<T>::type;
-//        typedef typename remove_all_extents<T>::type type;
     };
 
     template<typename T, std::size_t N>
     struct remove_all_extents<T[N]> {
-       using type = typename remove_all_extents<T>::type;
-        // typedef typename remove_all_extents<T>::type type;
+        using type = T;
+    };
+
+    template<typename T, std::size_t N1, std::size_t N2>
+    struct remove_all_extents<T[N1][N2]> {
+        using type = T;
+    };
+
+    template<typename T, std::size_t N1, std::size_t N2, std::size_t N3>
+    struct remove_all_extents<T[N1][N2][N3]> {
+        using type = T;
+    };
+
+    template<typename T, std::size_t N1, std::size_t N2, std::size_t N3, std::size_t N4>
+    struct remove_all_extents<T[N1][N2][N3][N4]> {
+        using type = typename remove_all_extents<T>::type;
     };
+#endif
 
     template<typename T>
     using remove_all_extents_t = typename remove_all_extents<T>::type;
@@ -693,6 +966,161 @@ namespace miscellaneous_transformation {
 
     template<bool B, typename T, typename U>
     using conditional_t = typename conditional<B, T, U>::type;
+
+#if TYPE_TRAIT_HAS_BUILTIN(__remove_cvref)
+    //Note : __remove_cvref is compiler feature
+    template<typename T>
+    struct remove_cvref {
+        using type = __remove_cvref(T);
+    };
+#else
+    /*Since c++20 in std : every cv and reference combination in one step*/
+    template<typename T>
+    struct remove_cvref {
+        using type = T;
+    };
+
+    template<typename T>
+    struct remove_cvref<T const> {
+        using type = T;
+    };
+
+    template<typename T>
+    struct remove_cvref<T volatile> {
+        using type = T;
+    };
+
+    template<typename T>
+    struct remove_cvref<T const volatile> {
+        using type = T;
+    };
+
+    template<typename T>
+    struct remove_cvref<T&> {
+        using type = T;
+    };
+
+    template<typename T>
+    struct remove_cvref<T const&> {
+        using type = T;
+    };
+
+    template<typename T>
+    struct remove_cvref<T volatile&> {
+        using type = T;
+    };
+
+    template<typename T>
+    struct remove_cvref<T const volatile&> {
+        using type = T;
+    };
+
+    template<typename T>
+    struct remove_cvref<T&&> {
+        using type = T;
+    };
+
+    template<typename T>
+    struct remove_cvref<T const&&> {
+        using type = T;
+    };
+
+    template<typename T>
+    struct remove_cvref<T volatile&&> {
+        using type = T;
+    };
+
+    template<typename T>
+    struct remove_cvref<T const volatile&&> {
+        using type = T;
+    };
+#endif
+
+    template<typename T>
+    using remove_cvref_t = typename remove_cvref<T>::type;
+
+    /*
+     * Type of a by-value parameter : array to pointer, function to function pointer, cv dropped.
+     * Abominable function types are left unchanged, as add_pointer leaves them.
+     */
+    template<typename T>
+    struct decay_helper {
+        using type = remove_const_volatile::remove_cv_t<T>;
+    };
+
+    template<typename T>
+    struct decay_helper<T[]> {
+        using type = T*;
+    };
+
+    template<typename T, std::size_t N>
+    struct decay_helper<T[N]> {
+        using type = T*;
+    };
+
+    template<typename R, typename... Args>
+    struct decay_helper<R(Args...)> {
+        using type = R(*)(Args...);
+    };
+
+    template<typename R, typename... Args>
+    struct decay_helper<R(Args..., ...)> {
+        using type = R(*)(Args..., ...);
+    };
+
+    template<typename R, typename... Args>
+    struct decay_helper<R(Args...) noexcept> {
+        using type = R(*)(Args...) noexcept;
+    };
+
+    template<typename R, typename... Args>
+    struct decay_helper<R(Args..., ...) noexcept> {
+        using type = R(*)(Args..., ...) noexcept;
+    };
+
+#if TYPE_TRAIT_HAS_BUILTIN(__decay)
+    //Note : __decay is compiler feature
+    template<typename T>
+    struct decay {
+        using type = __decay(T);
+    };
+#else
+    template<typename T>
+    struct decay {
+        using type = typename decay_helper<references::remove_reference_t<T>>::type;
+    };
+#endif
+
+    template<typename T>
+    using decay_t = typename decay<T>::type;
+
+    /*Smallest unsigned type holding every value in [0, Max]*/
+    template<unsigned long long Max>
+    struct uint_least_for {
+        using type = conditional_t<Max <= 0xffull, std::uint8_t,
+                     conditional_t<Max <= 0xffffull, std::uint16_t,
+                     conditional_t<Max <= 0xffffffffull, std::uint32_t, std::uint64_t>>>;
+
+        static_assert(type_properties::is_unsigned_v<type>, "uint_least_for must select an unsigned type");
+    };
+
+    template<unsigned long long Max>
+    using uint_least_for_t = typename uint_least_for<Max>::type;
+
+    /*Smallest signed type holding every value in [Min, Max]*/
+    template<long long Min, long long Max>
+    struct int_least_for {
+        static_assert(Min <= Max, "int_least_for needs Min <= Max");
+
+        using type = conditional_t<Min >= -0x80ll && Max <= 0x7fll, std::int8_t,
+                     conditional_t<Min >= -0x8000ll && Max <= 0x7fffll, std::int16_t,
+                     conditional_t<Min >= -0x80000000ll && Max <= 0x7fffffffll, std::int32_t, std::int64_t>>>;
+
+        static_assert(type_properties::is_signed_v<type>, "int_least_for must select a signed type");
+    };
+
+    template<long long Min, long long Max>
+    using int_least_for_t = typename int_least_for<Min, Max>::type;
 }
 
 namespace operations_on_traits {
@@ -700,11 +1128,135 @@ namespace operations_on_traits {
 }
 
 namespace members_relationships {
+    using namespace type_properties;
+    using namespace references;
+    using namespace miscellaneous_transformation;
+
+    /*Converts to any field type, except the aggregate itself which would be a copy*/
+    template<typename Aggregate>
+    struct any_field {
+        template<typename T, typename = enable_if_t<!is_same_v<remove_cv_t<T>, Aggregate>>>
+        constexpr operator T() const noexcept;
+    };
+
+    template<typename T, std::size_t>
+    using any_field_for = any_field<T>;
+
+    template<typename T, typename... Fields>
+    class is_brace_constructible_from {
+        private:
+            template<typename C>
+            static char test(decltype(C{std::declval<Fields>()...})*);
+
+            template<typename C>
+            static long test(...);
+
+        public:
+            static constexpr bool value = sizeof(test<T>(0)) == sizeof(char);
+    };
+
+    template<typename T, typename Indices>
+    struct is_brace_constructible_with;
+
+    template<typename T, std::size_t... Is>
+    struct is_brace_constructible_with<T, std::index_sequence<Is...>>
+        : public bool_constant<is_brace_constructible_from<T, any_field_for<T, Is>...>::value> { };
+
+    /*The largest N such that T{f0, ..., fN-1} compiles*/
+    template<typename T, std::size_t N = 0,
+             bool = is_brace_constructible_with<T, std::make_index_sequence<N + 1>>::value>
+    struct field_count_helper : public integral_constant<std::size_t, N> { };
+
+    template<typename T, std::size_t N>
+    struct field_count_helper<T, N, true> : public field_count_helper<T, N + 1> { };
 
+    /*
+     * Note : counts by brace-initialisation probing, so it needs an aggregate whose
+     * fields are not C arrays (brace elision would count their elements) and without bases.
+     */
+    template<typename T>
+    struct field_count : public field_count_helper<T> {
+        static_assert(is_aggregate_v<T>, "field_count needs an aggregate");
+    };
+
+    template<typename T>
+    inline constexpr std::size_t field_count_v = field_count<T>::value;
+
+    inline constexpr std::size_t max_reflected_fields = 12;
+
+    /*std::tie of every field, through structured bindings*/
+    template<typename T>
+    constexpr auto tie_fields(T& value) noexcept {
+        constexpr std::size_t count = field_count_v<remove_cv_t<T>>;
+        static_assert(count <= max_reflected_fields, "tie_fields: too many fields");
+
+        if constexpr (count == 0) {
+            return std::tie();
+        } else if constexpr (count == 1) {
+            auto& [f0] = value;
+            return std::tie(f0);
+        } else if constexpr (count == 2) {
+            auto& [f0, f1] = value;
+            return std::tie(f0, f1);
+        } else if constexpr (count == 3) {
+            auto& [f0, f1, f2] = value;
+            return std::tie(f0, f1, f2);
+        } else if constexpr (count == 4) {
+            auto& [f0, f1, f2, f3] = value;
+            return std::tie(f0, f1, f2, f3);
+        } else if constexpr (count == 5) {
+            auto& [f0, f1, f2, f3, f4] = value;
+            return std::tie(f0, f1, f2, f3, f4);
+        } else if constexpr (count == 6) {
+            auto& [f0, f1, f2, f3, f4, f5] = value;
+            return std::tie(f0, f1, f2, f3, f4, f5);
+        } else if constexpr (count == 7) {
+            auto& [f0, f1, f2, f3, f4, f5, f6] = value;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6);
+        } else if constexpr (count == 8) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7] = value;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7);
+        } else if constexpr (count == 9) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = value;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+        } else if constexpr (count == 10) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = value;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+        } else if constexpr (count == 11) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = value;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+        } else if constexpr (count == 12) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = value;
+            return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+        }
+    }
+
+    template<typename T, std::size_t I>
+    struct field_type {
+        using type = remove_reference_t<std::tuple_element_t<I, decltype(tie_fields(std::declval<T&>()))>>;
+    };
+
+    template<typename T, std::size_t I>
+    using field_t = typename field_type<T, I>::type;
 }
 
 namespace constant_evaluation_context {
-
+    /*
+     * True while the enclosing constexpr function is being constant evaluated.
+     * Branch on it with a plain if, never if constexpr : the runtime branch may call
+     * memcpy and intrinsics, which only need to be constexpr on the other side.
+     * Note : without the builtin this is always false and every call takes the runtime branch.
+     */
+    constexpr bool is_constant_evaluated() noexcept {
+#if defined(__cpp_lib_is_constant_evaluated)
+        return std::is_constant_evaluated();
+#elif TYPE_TRAIT_HAS_BUILTIN(__builtin_is_constant_evaluated)
+        //Note : __builtin_is_constant_evaluated is compiler feature (GCC 9, Clang 9), usable in C++17
+        return __builtin_is_constant_evaluated();
+#else
+        return false;
+#endif
+    }
 }
 
 namespace extension {
@@ -738,4 +1290,6 @@ namespace extension {
 }
 
 // template<typename T>
-// inline constexpr bool remove_pointer_t = typename pointer::remove_pointer<T>::type;
\ No newline at end of file
+// inline constexpr bool remove_pointer_t = typename pointer::remove_pointer<T>::type;
+
+#endif
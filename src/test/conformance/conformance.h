@@ -0,0 +1,288 @@
+#ifndef INCLUDE_CONFORMANCE_H
+#define INCLUDE_CONFORMANCE_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "type_trait.h"
+
+/*
+ * Differential static_assert suite : every trait of type_trait.h against its std:: twin.
+ * The checked types are generated from a list of 40 base types by applying two layers of
+ * cv/pointer/reference/array/member pointer wrappers. CMake compiles it once per shard,
+ * with CONFORMANCE_SHARD and CONFORMANCE_SHARDS defined; shard s takes the bases whose
+ * index is s modulo the shard count.
+ * A failure is a static_assert naming the trait, with the offending T in the
+ * "In instantiation of check_type<T>" note of the compiler.
+ */
+namespace conformance {
+    template<typename... Ts>
+    struct type_list { };
+
+    struct Class { int i; };
+    struct Derived : Class { };
+    struct Unrelated { };
+    struct Empty { };
+    struct Padded { char c; int i; };
+    struct Packed { int a; int b; };
+    struct Aggregate { int a; double b; };
+    struct NonTrivial { NonTrivial(const NonTrivial&); };
+    struct Abstract { virtual void f() = 0; };
+    struct Final final { };
+    union Union { int i; float f; };
+    enum Enum { enum_value };
+    enum class Scoped : unsigned char { value };
+
+    using bases = type_list<
+        void, decltype(nullptr), bool, char, signed char, unsigned char, wchar_t, char16_t, char32_t,
+        short, unsigned short, int, unsigned int, long, unsigned long, long long, unsigned long long,
+        float, double, long double,
+        Class, Derived, Unrelated, Empty, Padded, Packed, Aggregate, NonTrivial, Abstract, Final, Union, Enum, Scoped,
+        int(), void(int, ...), int(double) noexcept, int() const, void() &&,
+        int Class::*, int (Class::*)() const>;
+
+    /*Wrappers, each well-formed for every type : ill-formed combinations leave T unchanged*/
+    template<typename T>
+    struct as_is { using type = T; };
+
+    template<typename T>
+    struct with_const { using type = std::add_const_t<T>; };
+
+    template<typename T>
+    struct with_volatile { using type = std::add_volatile_t<T>; };
+
+    template<typename T>
+    struct with_cv { using type = std::add_cv_t<T>; };
+
+    template<typename T>
+    struct with_pointer { using type = std::add_pointer_t<T>; };
+
+    template<typename T>
+    struct with_lvalue_reference { using type = std::add_lvalue_reference_t<T>; };
+
+    template<typename T>
+    struct with_rvalue_reference { using type = std::add_rvalue_reference_t<T>; };
+
+    template<typename T>
+    inline constexpr bool is_array_element_v = std::is_object_v<T> && !std::is_abstract_v<T> &&
+                                               !(std::is_array_v<T> && std::extent_v<T> == 0);
+
+    template<typename T, bool = is_array_element_v<T>>
+    struct with_extent { using type = T; };
+
+    template<typename T>
+    struct with_extent<T, true> { using type = T[3]; };
+
+    template<typename T, bool = is_array_element_v<T>>
+    struct with_unknown_bound { using type = T; };
+
+    template<typename T>
+    struct with_unknown_bound<T, true> { using type = T[]; };
+
+    template<typename T, bool = !std::is_reference_v<T> && !std::is_void_v<T>>
+    struct with_member_pointer { using type = T; };
+
+    template<typename T>
+    struct with_member_pointer<T, true> { using type = T Class::*; };
+
+    template<typename T>
+    using wrappings = type_list<typename as_is<T>::type,
+                                typename with_const<T>::type,
+                                typename with_volatile<T>::type,
+                                typename with_cv<T>::type,
+                                typename with_pointer<T>::type,
+                                typename with_lvalue_reference<T>::type,
+                                typename with_rvalue_reference<T>::type,
+                                typename with_extent<T>::type,
+                                typename with_unknown_bound<T>::type,
+                                typename with_member_pointer<T>::type>;
+
+    template<std::size_t I, typename List>
+    struct type_at;
+
+    template<typename T, typename... Ts>
+    struct type_at<0, type_list<T, Ts...>> {
+        using type = T;
+    };
+
+    template<std::size_t I, typename T, typename... Ts>
+    struct type_at<I, type_list<T, Ts...>> : public type_at<I - 1, type_list<Ts...>> { };
+
+    template<typename List>
+    struct size_of;
+
+    template<typename... Ts>
+    struct size_of<type_list<Ts...>> : public std::integral_constant<std::size_t, sizeof...(Ts)> { };
+
+    /*Bound and unbound arrays as std::is_bounded_array / std::is_unbounded_array (C++20) define them*/
+    template<typename T>
+    inline constexpr bool std_is_bounded_array_v = std::is_array_v<T> && std::extent_v<T> != 0;
+
+    template<typename T>
+    inline constexpr bool std_is_unbounded_array_v = std::is_array_v<T> && std::extent_v<T> == 0;
+
+#define CONFORMANCE_VALUE(NAMESPACE, TRAIT) \
+    static_assert(NAMESPACE::TRAIT<T>::value == std::TRAIT<T>::value, #NAMESPACE "::" #TRAIT " disagrees with std::" #TRAIT)
+
+#define CONFORMANCE_TYPE(NAMESPACE, TRAIT) \
+    static_assert(std::is_same_v<typename NAMESPACE::TRAIT<T>::type, typename std::TRAIT<T>::type>, \
+                  #NAMESPACE "::" #TRAIT " disagrees with std::" #TRAIT)
+
+    template<typename T>
+    constexpr std::size_t check_type() {
+        CONFORMANCE_TYPE(remove_const_volatile, remove_const);
+        CONFORMANCE_TYPE(remove_const_volatile, remove_volatile);
+        CONFORMANCE_TYPE(remove_const_volatile, remove_cv);
+
+        static_assert(type_relationships::is_same_v<T, T>, "type_relationships::is_same disagrees with std::is_same");
+        static_assert(type_relationships::is_same_v<T, std::remove_cv_t<T>> == std::is_same_v<T, std::remove_cv_t<T>>,
+                      "type_relationships::is_same disagrees with std::is_same");
+        static_assert(type_relationships::is_same_v<T, int> == std::is_same_v<T, int>,
+                      "type_relationships::is_same disagrees with std::is_same");
+
+        CONFORMANCE_VALUE(type_categories, is_void);
+        CONFORMANCE_VALUE(type_categories, is_null_pointer);
+        CONFORMANCE_VALUE(type_categories, is_integral);
+        CONFORMANCE_VALUE(type_categories, is_floating_point);
+        CONFORMANCE_VALUE(type_categories, is_array);
+        CONFORMANCE_VALUE(type_categories, is_enum);
+        CONFORMANCE_VALUE(type_categories, is_union);
+        CONFORMANCE_VALUE(type_categories, is_class);
+        CONFORMANCE_VALUE(type_categories, is_function);
+        CONFORMANCE_VALUE(type_categories, is_pointer);
+        CONFORMANCE_VALUE(type_categories, is_lvalue_reference);
+        CONFORMANCE_VALUE(type_categories, is_rvalue_reference);
+
+        CONFORMANCE_VALUE(composite_categories, is_arithmetic);
+        CONFORMANCE_VALUE(composite_categories, is_fundamental);
+        CONFORMANCE_VALUE(composite_categories, is_member_pointer);
+        CONFORMANCE_VALUE(composite_categories, is_scalar);
+        CONFORMANCE_VALUE(composite_categories, is_object);
+        CONFORMANCE_VALUE(composite_categories, is_compound);
+        CONFORMANCE_VALUE(composite_categories, is_reference);
+
+        CONFORMANCE_VALUE(type_properties, is_const);
+        CONFORMANCE_VALUE(type_properties, is_volatile);
+        CONFORMANCE_VALUE(type_properties, is_signed);
+        CONFORMANCE_VALUE(type_properties, is_unsigned);
+        CONFORMANCE_VALUE(type_properties, is_trivially_copyable);
+        CONFORMANCE_VALUE(type_properties, has_unique_object_representations);
+        CONFORMANCE_VALUE(type_properties, is_aggregate);
+        static_assert(type_properties::is_bounded_array_v<T> == std_is_bounded_array_v<T>,
+                      "type_properties::is_bounded_array disagrees with std::is_bounded_array");
+        static_assert(type_properties::is_unbounded_array_v<T> == std_is_unbounded_array_v<T>,
+                      "type_properties::is_unbounded_array disagrees with std::is_unbounded_array");
+
+        CONFORMANCE_VALUE(supported_operations, is_default_constructible);
+        CONFORMANCE_VALUE(supported_operations, is_trivially_default_constructible);
+        CONFORMANCE_VALUE(supported_operations, is_destructible);
+        CONFORMANCE_VALUE(supported_operations, is_trivially_destructible);
+        using copied = std::add_lvalue_reference_t<std::add_const_t<T>>;
+        static_assert(supported_operations::is_constructible_v<T, copied> == std::is_constructible_v<T, copied>,
+                      "supported_operations::is_constructible disagrees with std::is_constructible");
+        static_assert(supported_operations::is_trivially_constructible_v<T, copied> == std::is_trivially_constructible_v<T, copied>,
+                      "supported_operations::is_trivially_constructible disagrees with std::is_trivially_constructible");
+        using assigned = std::add_lvalue_reference_t<T>;
+        static_assert(supported_operations::is_assignable_v<assigned, copied> == std::is_assignable_v<assigned, copied>,
+                      "supported_operations::is_assignable disagrees with std::is_assignable");
+        static_assert(supported_operations::is_trivially_assignable_v<assigned, copied> == std::is_trivially_assignable_v<assigned, copied>,
+                      "supported_operations::is_trivially_assignable disagrees with std::is_trivially_assignable");
+
+        if constexpr (std::is_object_v<std::remove_reference_t<T>>) {
+            CONFORMANCE_VALUE(property_queries, alignment_of);
+        }
+
+        CONFORMANCE_TYPE(references, remove_reference);
+        CONFORMANCE_TYPE(references, add_lvalue_reference);
+        CONFORMANCE_TYPE(references, add_rvalue_reference);
+        CONFORMANCE_TYPE(pointers, remove_pointer);
+        CONFORMANCE_TYPE(pointers, add_pointer);
+        CONFORMANCE_TYPE(arrays, remove_extent);
+        CONFORMANCE_TYPE(arrays, remove_all_extents);
+        CONFORMANCE_TYPE(miscellaneous_transformation, decay);
+        static_assert(std::is_same_v<miscellaneous_transformation::remove_cvref_t<T>, std::remove_cv_t<std::remove_reference_t<T>>>,
+                      "miscellaneous_transformation::remove_cvref disagrees with std::remove_cvref");
+
+        return 1;
+    }
+
+#undef CONFORMANCE_VALUE
+#undef CONFORMANCE_TYPE
+
+    template<typename... Ts>
+    constexpr std::size_t check_types(type_list<Ts...>) {
+        return (std::size_t(0) + ... + check_type<Ts>());
+    }
+
+    /*Every wrapping of every wrapping of T*/
+    template<typename... Ts>
+    constexpr std::size_t check_wrapped(type_list<Ts...>) {
+        return (std::size_t(0) + ... + check_types(wrappings<Ts>{}));
+    }
+
+    template<std::size_t I, std::size_t Shard, std::size_t Shards>
+    constexpr std::size_t check_base() {
+        if constexpr (I % Shards == Shard) {
+            return check_wrapped(wrappings<typename type_at<I, bases>::type>{});
+        } else {
+            return 0;
+        }
+    }
+
+    template<std::size_t Shard, std::size_t Shards, std::size_t... Is>
+    constexpr std::size_t check_shard(std::index_sequence<Is...>) {
+        return (std::size_t(0) + ... + check_base<Is, Shard, Shards>());
+    }
+
+    /*Class pairs for is_base_of, checked by shard 0 only*/
+    using classes = type_list<Class, Derived, Unrelated, Empty, Aggregate, Abstract, Final, Union, int>;
+
+    template<typename Base, typename... Ds>
+    constexpr std::size_t check_bases_of(type_list<Ds...>) {
+        static_assert(((type_relationships::is_base_of<Base, Ds>::value == std::is_base_of_v<Base, Ds>) && ...),
+                      "type_relationships::is_base_of disagrees with std::is_base_of");
+        return sizeof...(Ds);
+    }
+
+    template<typename... Bs>
+    constexpr std::size_t check_base_pairs(type_list<Bs...>) {
+        return (std::size_t(0) + ... + check_bases_of<Bs>(classes{}));
+    }
+
+    struct report {
+        std::size_t shards = 0;
+        std::size_t types = 0;
+    };
+
+    /*Defined by main.cc, filled in by the shards during static initialization*/
+    report& results();
+
+    inline bool record(std::size_t types) {
+        ++results().shards;
+        results().types += types;
+        return true;
+    }
+}
+
+#if defined(CONFORMANCE_SHARD)
+namespace conformance {
+    template<std::size_t Shard>
+    constexpr std::size_t checked_types() {
+        std::size_t count = check_shard<Shard, CONFORMANCE_SHARDS>(std::make_index_sequence<size_of<bases>::value>{});
+        if constexpr (Shard == 0) {
+            count += check_base_pairs(classes{});
+        }
+        return count;
+    }
+
+    namespace {
+        /*The whole suite runs while compiling this constant*/
+        constexpr std::size_t shard_types = checked_types<CONFORMANCE_SHARD>();
+
+        const bool recorded = record(shard_types);
+    }
+}
+#endif
+
+#endif
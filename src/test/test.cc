@@ -1,7 +1,35 @@
 #define BOOST_TEST_MODULE type_trait_test
+#define INSTRUMENTATION_COUNT_ALLOCATIONS
 
 #include <boost/test/included/unit_test.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
 #include "type_trait.h"
+#include "enum_reflection.h"
+#include "static_map.h"
+#include "atomic_storage.h"
+#include "ring_buffer.h"
+#include "fast_cast.h"
+#include "hashing.h"
+#include "algorithms.h"
+#include "function_traits.h"
+#include "event_bus.h"
+#include "soa_vector.h"
+#include "packed_int_array.h"
+#include "tagged_ptr.h"
+#include "constexpr_math.h"
+#include "object_pool.h"
 #include "utils.h"
 
 BOOST_AUTO_TEST_CASE (test_integral_constant) { 
@@ -69,6 +97,9 @@ BOOST_AUTO_TEST_CASE(test_type_categories) {
     BOOST_TEST(bool(is_integral_v<int>) == true);
     BOOST_TEST(bool(is_integral_v<long>) == true);
     BOOST_TEST(bool(is_integral_v<long long>) == true);
+    BOOST_TEST(bool(is_integral_v<unsigned char>) == true);
+    BOOST_TEST(bool(is_integral_v<unsigned long long>) == true);
+    BOOST_TEST(bool(is_integral_v<int const volatile>) == true);
     BOOST_TEST(bool(is_integral_v<A>) == false);
     BOOST_TEST(bool(is_integral_v<E>) == false);
     BOOST_TEST(bool(is_integral_v<float>) == false);
@@ -77,6 +108,7 @@ BOOST_AUTO_TEST_CASE(test_type_categories) {
     BOOST_TEST(bool(is_floating_point_v<float>) == true);
     BOOST_TEST(bool(is_floating_point_v<double>) == true);
     BOOST_TEST(bool(is_floating_point_v<long double>) == true);
+    BOOST_TEST(bool(is_floating_point_v<double const>) == true);
     BOOST_TEST(bool(is_floating_point_v<int*>) == false);
 
     class C{};
@@ -118,7 +150,7 @@ BOOST_AUTO_TEST_CASE(test_composite_categories) {
     class C {};
     BOOST_TEST(bool(is_arithmetic_v<C>) == false);
     BOOST_TEST(bool(is_arithmetic_v<int>) == true);
-    BOOST_TEST(bool(is_arithmetic_v<int const>) == false); /*true?*/ 
+    BOOST_TEST(bool(is_arithmetic_v<int const>) == true);
     BOOST_TEST(bool(is_arithmetic_v<float>) == true);
     BOOST_TEST(bool(is_arithmetic_v<float const&>) == false);
     BOOST_TEST(bool(is_arithmetic_v<char>) == true);
@@ -174,19 +206,64 @@ BOOST_AUTO_TEST_CASE(test_type_properties) {
 
     BOOST_TEST(bool(is_unsigned_v<float>) == false);
     BOOST_TEST(bool(is_unsigned_v<signed int>) == false);
-    BOOST_TEST(bool(is_unsigned_v<unsigned int>) == false);
+    BOOST_TEST(bool(is_unsigned_v<unsigned int>) == true);
+
+    struct Copyable { int a; double b; };
+    struct NonCopyable { NonCopyable(const NonCopyable&); };
+    BOOST_TEST(bool(is_trivially_copyable_v<Copyable>) == true);
+    BOOST_TEST(bool(is_trivially_copyable_v<int const>) == true);
+    BOOST_TEST(bool(is_trivially_copyable_v<NonCopyable>) == false);
+
+    struct Packed { int a; int b; };
+    struct Padded { char a; int b; };
+    BOOST_TEST(bool(has_unique_object_representations_v<int>) == true);
+    BOOST_TEST(bool(has_unique_object_representations_v<float>) == false);
+    BOOST_TEST(bool(has_unique_object_representations_v<Packed>) == true);
+    BOOST_TEST(bool(has_unique_object_representations_v<Packed[4]>) == true);
+    BOOST_TEST(bool(has_unique_object_representations_v<Padded>) == false);
+    BOOST_TEST(bool(has_unique_object_representations_v<Copyable>) == false);
 }
 
 BOOST_AUTO_TEST_CASE(test_supported_operations_) {
     using namespace supported_operations;
 
     TEST_LOG();
+
+    struct Trivial { int a; double b; };
+    struct Owning { std::string name; };
+    struct NoDefault { explicit NoDefault(int) { } };
+    struct Locked { ~Locked() = delete; };
+
+    BOOST_TEST(bool(is_default_constructible_v<Trivial>) == true);
+    BOOST_TEST(bool(is_default_constructible_v<NoDefault>) == false);
+    BOOST_TEST(bool(is_constructible_v<NoDefault, int>) == true);
+    BOOST_TEST(bool(is_constructible_v<int&, int>) == false);
+    BOOST_TEST(bool(is_trivially_default_constructible_v<Trivial>) == true);
+    BOOST_TEST(bool(is_trivially_default_constructible_v<Owning>) == false);
+    BOOST_TEST(bool(is_trivially_constructible_v<Trivial, const Trivial&>) == true);
+
+    BOOST_TEST(bool(is_destructible_v<Owning>) == true);
+    BOOST_TEST(bool(is_destructible_v<Locked>) == false);
+    BOOST_TEST(bool(is_destructible_v<Locked&>) == true);
+    BOOST_TEST(bool(is_destructible_v<int[3]>) == true);
+    BOOST_TEST(bool(is_destructible_v<int[]>) == false);
+    BOOST_TEST(bool(is_destructible_v<void>) == false);
+    BOOST_TEST(bool(is_trivially_destructible_v<Trivial>) == true);
+    BOOST_TEST(bool(is_trivially_destructible_v<Owning>) == false);
+    BOOST_TEST(bool(is_trivially_destructible_v<Locked>) == false);
 }
 
 BOOST_AUTO_TEST_CASE(test_property_queries) {
     using namespace property_queries;
 
     TEST_LOG();
+
+    struct alignas(16) Aligned { char c; };
+
+    BOOST_TEST(alignment_of_v<char> == 1u);
+    BOOST_TEST(alignment_of_v<std::uint32_t> == 4u);
+    BOOST_TEST(alignment_of_v<Aligned> == 16u);
+    BOOST_TEST(alignment_of_v<Aligned[3]> == 16u);
 }
 
 
@@ -199,6 +276,14 @@ BOOST_AUTO_TEST_CASE(test_references) {
     BOOST_TEST(bool(is_same_v<remove_reference_t<int&&>, int>) == true);
     BOOST_TEST(bool(is_same_v<remove_reference_t<int&>, int>) == true);
     BOOST_TEST(bool(is_same_v<remove_reference_t<int&>, float>) == false);
+
+    BOOST_TEST(bool(is_same_v<add_lvalue_reference_t<int>, int&>) == true);
+    BOOST_TEST(bool(is_same_v<add_lvalue_reference_t<int&&>, int&>) == true);
+    BOOST_TEST(bool(is_same_v<add_lvalue_reference_t<void>, void>) == true);
+    BOOST_TEST(bool(is_same_v<add_lvalue_reference_t<int() const>, int() const>) == true);
+    BOOST_TEST(bool(is_same_v<add_rvalue_reference_t<int>, int&&>) == true);
+    BOOST_TEST(bool(is_same_v<add_rvalue_reference_t<int&>, int&>) == true);
+    BOOST_TEST(bool(is_same_v<add_rvalue_reference_t<void const>, void const>) == true);
 }
 
 BOOST_AUTO_TEST_CASE(test_pointer) {
@@ -210,6 +295,14 @@ BOOST_AUTO_TEST_CASE(test_pointer) {
     BOOST_TEST(bool(is_same_v<remove_pointer_t<int*>, int>) == true);
     BOOST_TEST(bool(is_same_v<remove_pointer_t<int* const volatile>, int>) == true);
     BOOST_TEST(bool(is_same_v<remove_pointer_t<int*>, float>) == false);
+    BOOST_TEST(bool(is_same_v<remove_pointer_t<int>, int>) == true);
+    BOOST_TEST(bool(is_same_v<remove_pointer_t<int**>, int*>) == true);
+
+    BOOST_TEST(bool(is_same_v<add_pointer_t<int>, int*>) == true);
+    BOOST_TEST(bool(is_same_v<add_pointer_t<int const&>, int const*>) == true);
+    BOOST_TEST(bool(is_same_v<add_pointer_t<void>, void*>) == true);
+    BOOST_TEST(bool(is_same_v<add_pointer_t<int(double)>, int(*)(double)>) == true);
+    BOOST_TEST(bool(is_same_v<add_pointer_t<int() &&>, int() &&>) == true);
 } 
 
 BOOST_AUTO_TEST_CASE(test_sign_modifiers) {
@@ -233,6 +326,9 @@ BOOST_AUTO_TEST_CASE(test_arrays) {
 
     BOOST_TEST(bool(is_same_v<remove_all_extents_t<float[1][2][3]>, float>) == true);
     BOOST_TEST(bool(is_same_v<remove_all_extents_t<S[1][2][3]>, S>) == true);
+    BOOST_TEST(bool(is_same_v<remove_all_extents_t<int const[][1][2][3][4][5][6][7][8][9]>, int const>) == true);
+    BOOST_TEST(bool(is_same_v<remove_all_extents_t<int*[1][2][3][4]>, int*>) == true);
+    BOOST_TEST(bool(is_same_v<remove_all_extents_t<int(*)[2]>, int(*)[2]>) == true);
 }
 
 BOOST_AUTO_TEST_CASE(test_miscellaneous_transformation) {
@@ -243,6 +339,29 @@ BOOST_AUTO_TEST_CASE(test_miscellaneous_transformation) {
 
     BOOST_TEST(bool(is_same_v<conditional_t<true, int, double>, int>) == true);
     BOOST_TEST(bool(is_same_v<conditional_t<false, int, double>, double>) == true);
+
+    BOOST_TEST(bool(is_same_v<uint_least_for_t<0>, std::uint8_t>) == true);
+    BOOST_TEST(bool(is_same_v<uint_least_for_t<255>, std::uint8_t>) == true);
+    BOOST_TEST(bool(is_same_v<uint_least_for_t<256>, std::uint16_t>) == true);
+    BOOST_TEST(bool(is_same_v<uint_least_for_t<(1u << 20) - 1>, std::uint32_t>) == true);
+    BOOST_TEST(bool(is_same_v<uint_least_for_t<0x100000000ull>, std::uint64_t>) == true);
+
+    BOOST_TEST(bool(is_same_v<int_least_for_t<-128, 127>, std::int8_t>) == true);
+    BOOST_TEST(bool(is_same_v<int_least_for_t<0, 128>, std::int16_t>) == true);
+    BOOST_TEST(bool(is_same_v<int_least_for_t<-32769, 0>, std::int32_t>) == true);
+    BOOST_TEST(bool(is_same_v<int_least_for_t<0, 0x80000000ll>, std::int64_t>) == true);
+
+    BOOST_TEST(bool(is_same_v<remove_cvref_t<int const volatile&>, int>) == true);
+    BOOST_TEST(bool(is_same_v<remove_cvref_t<int const&&>, int>) == true);
+    BOOST_TEST(bool(is_same_v<remove_cvref_t<int const*>, int const*>) == true);
+    BOOST_TEST(bool(is_same_v<remove_cvref_t<int const[2]>, int[2]>) == true);
+
+    BOOST_TEST(bool(is_same_v<decay_t<int const&>, int>) == true);
+    BOOST_TEST(bool(is_same_v<decay_t<int const(&)[2][3]>, int const(*)[3]>) == true);
+    BOOST_TEST(bool(is_same_v<decay_t<int[]>, int*>) == true);
+    BOOST_TEST(bool(is_same_v<decay_t<void(&)(int, ...)>, void(*)(int, ...)>) == true);
+    BOOST_TEST(bool(is_same_v<decay_t<int(double) noexcept>, int(*)(double) noexcept>) == true);
+    BOOST_TEST(bool(is_same_v<decay_t<int() const>, int() const>) == true);
 }
 
 BOOST_AUTO_TEST_CASE(test_operations_on_traits) {
@@ -253,14 +372,95 @@ BOOST_AUTO_TEST_CASE(test_operations_on_traits) {
 
 BOOST_AUTO_TEST_CASE(test_member_relationships) {
     using namespace members_relationships;
+    using namespace type_relationships;
 
     TEST_LOG();
+
+    struct Empty { };
+    struct Point { int x; int y; };
+    struct Record { long id; double price; std::string name; Point where; };
+
+    static_assert(field_count_v<Empty> == 0);
+    static_assert(field_count_v<Point> == 2);
+    static_assert(field_count_v<Record> == 4);
+    static_assert(is_same_v<field_t<Record, 1>, double>);
+    static_assert(is_same_v<field_t<Record, 3>, Point>);
+    static_assert(is_same_v<field_t<const Record, 2>, const std::string>);
+
+    BOOST_TEST(bool(is_aggregate_v<Point>) == true);
+    BOOST_TEST(bool(is_aggregate_v<std::string>) == false);
+
+    Record record{1, 2.5, "bolt", {3, 4}};
+    auto fields = tie_fields(record);
+    std::get<1>(fields) = 9.0;
+    BOOST_TEST(record.price == 9.0);
+    BOOST_TEST(std::get<3>(fields).y == 4);
+}
+
+namespace constexpr_math_test {
+    constexpr std::uint64_t words[] = {0, 1, 0xffffffffffffffffull, 0x8000000000000001ull, 0x0123456789abcdefull, 7};
+
+    constexpr std::array<int, 4> copied() {
+        std::array<int, 4> source = {1, 2, 3, 4};
+        std::array<int, 4> target = {};
+        constexpr_math::copy(source.data(), source.size(), target.data());
+        return target;
+    }
 }
 
 BOOST_AUTO_TEST_CASE(test_constant_evaluation_context) {
     using namespace constant_evaluation_context;
-    
+    using namespace constexpr_math_test;
+
     TEST_LOG();
+
+    static_assert(is_constant_evaluated());
+    BOOST_TEST(is_constant_evaluated() == false);
+
+    /*Compile-time answers, then the runtime path on the same inputs*/
+    static_assert(constexpr_math::popcount(0x0123456789abcdefull) == 32);
+    static_assert(constexpr_math::popcount(std::uint8_t(0xff)) == 8);
+    static_assert(constexpr_math::clz(std::uint32_t(1)) == 31);
+    static_assert(constexpr_math::clz(std::uint16_t(0)) == 16);
+    static_assert(constexpr_math::ctz(std::uint64_t(0x100)) == 8);
+    static_assert(constexpr_math::log2(std::uint64_t(1000)) == 9);
+    static_assert(constexpr_math::log2(std::uint32_t(0)) == -1);
+    static_assert(constexpr_math::popcount(words, 6) == 0 + 1 + 64 + 2 + 32 + 3);
+    static_assert(constexpr_math::sqrt(2.25) == 1.5);
+    static_assert(copied()[3] == 4);
+
+    volatile std::uint64_t runtime = 0x0123456789abcdefull;
+    BOOST_TEST(constexpr_math::popcount(static_cast<std::uint64_t>(runtime)) == 32);
+    BOOST_TEST(constexpr_math::clz(static_cast<std::uint64_t>(runtime)) == 7);
+    BOOST_TEST(constexpr_math::ctz(static_cast<std::uint64_t>(runtime)) == 0);
+    BOOST_TEST(constexpr_math::log2(static_cast<std::uint64_t>(runtime)) == 56);
+
+    std::vector<std::uint64_t> many(37);
+    std::size_t expected = 0;
+    for (std::size_t i = 0; i < many.size(); ++i) {
+        many[i] = i * 0x9e3779b97f4a7c15ull;
+        expected += constexpr_math::popcount(many[i]);
+    }
+    BOOST_TEST(constexpr_math::popcount(many.data(), many.size()) == expected);
+
+    /*Both sides correctly rounded : bit-identical*/
+    constexpr double inputs[] = {2.0, 3.0, 0.1, 1e-310, 1e300, 123456.789, 0.0, -0.0};
+    constexpr double roots[] = {constexpr_math::sqrt(inputs[0]), constexpr_math::sqrt(inputs[1]),
+                                constexpr_math::sqrt(inputs[2]), constexpr_math::sqrt(inputs[3]),
+                                constexpr_math::sqrt(inputs[4]), constexpr_math::sqrt(inputs[5]),
+                                constexpr_math::sqrt(inputs[6]), constexpr_math::sqrt(inputs[7])};
+    double runtime_roots[8];
+    constexpr_math::sqrt(inputs, 8, runtime_roots);
+    BOOST_TEST(std::memcmp(roots, runtime_roots, sizeof(roots)) == 0);
+    for (std::size_t i = 0; i < 8; ++i) {
+        BOOST_TEST(roots[i] == std::sqrt(inputs[i]));
+    }
+    BOOST_TEST(constexpr_math::sqrt(-1.0) != constexpr_math::sqrt(-1.0));
+
+    int source[5] = {1, 2, 3, 4, 5};
+    int target[5] = {};
+    BOOST_TEST(constexpr_math::copy(source, 5, target) == target + 5);
+    BOOST_TEST(std::memcmp(source, target, sizeof(source)) == 0);
 }
 
 BOOST_AUTO_TEST_CASE(test_extension) {
@@ -274,4 +474,993 @@ BOOST_AUTO_TEST_CASE(test_extension) {
     };
 
     BOOST_TEST(bool(has_method_update_v<C>) == true);
-}
\ No newline at end of file
+}
+
+namespace hierarchy_test {
+    using namespace hierarchy;
+
+    struct Shape : hierarchy_root<Shape> {
+        explicit Shape(int sides) : sides(sides) { }
+        virtual ~Shape() = default;
+        int sides;
+    };
+    struct Polygon : hierarchy_node<Polygon, Shape> {
+        Polygon() : hierarchy_node(4) { }
+    };
+    struct Triangle : hierarchy_node<Triangle, Polygon> { };
+    struct Square : hierarchy_node<Square, Polygon> { };
+    struct Circle : hierarchy_node<Circle, Shape> {
+        Circle() : hierarchy_node(0) { }
+    };
+}
+
+/*Registration order is free, numbering is pre-order from the root*/
+template<>
+struct hierarchy::class_hierarchy_of<hierarchy_test::Shape> {
+    using type = class_hierarchy<hierarchy_test::Shape, hierarchy_test::Circle, hierarchy_test::Triangle,
+                                 hierarchy_test::Polygon, hierarchy_test::Square>;
+};
+
+namespace hashing_test {
+    struct JoinKey {
+        std::uint64_t order;
+        std::uint32_t customer;
+        std::uint32_t region;
+    };
+
+    struct PaddedKey {
+        char kind;
+        std::uint32_t id;
+        double price;
+        std::string name;
+    };
+
+    inline auto hash_members(const PaddedKey& key) {
+        return std::tie(key.kind, key.id, key.price, key.name);
+    }
+}
+
+namespace callables_test {
+    struct Tick { int frame; };
+    struct Collision { int a, b; };
+
+    inline int ticks_logged = 0;
+    inline void log_tick(const Tick&) { ++ticks_logged; }
+    inline int add(int a, int b) noexcept { return a + b; }
+
+    struct Physics {
+        int last_frame = -1;
+        int collisions = 0;
+        void on_tick(const Tick& tick) { last_frame = tick.frame; }
+        void on_collision(const Collision&) { ++collisions; }
+        int scaled(int value) const & { return value * 2; }
+    };
+
+    struct Renderer {
+        int frames = 0;
+        void on_tick(const Tick&) noexcept { ++frames; }
+    };
+}
+
+namespace enum_test {
+    enum class Color { Red, Green = 5, Blue = -3 };
+    enum Plain { First, Second, Third };
+    enum class Opcode : unsigned char { Nop, Load, Store, Jump = 200 };
+    enum Flag : short { Off = -1, On = 1 };
+    enum class Below : int { Low = -10 };
+    /*Needs a reseeded name index*/
+    enum class Op : unsigned char { add, sub, div };
+}
+
+template<>
+struct enum_reflection::enum_range<enum_test::Plain> {
+    static constexpr int min = 0;
+    static constexpr int max = 3;
+};
+
+template<>
+struct enum_reflection::enum_range<enum_test::Below> {
+    static constexpr int min = -20;
+    static constexpr int max = -5;
+};
+
+template<>
+struct enum_reflection::enum_range<enum_test::Opcode> {
+    static constexpr int min = 0;
+    static constexpr int max = 255;
+};
+
+BOOST_AUTO_TEST_CASE(test_enum_reflection) {
+    using namespace enum_reflection;
+    using namespace enum_test;
+
+    TEST_LOG();
+
+    static_assert(enum_count_v<Color> == 3);
+    static_assert(enum_values_v<Color>[0] == Color::Blue);
+    static_assert(enum_name(Color::Green) == "Green");
+    static_assert(enum_cast<Color>("Red") == Color::Red);
+
+    static_assert(detail::has_fixed_underlying_type<Opcode>::value);
+    static_assert(detail::has_fixed_underlying_type<Flag>::value);
+    static_assert(!detail::has_fixed_underlying_type<Plain>::value);
+
+    BOOST_TEST(enum_count_v<Plain> == 3u);
+    BOOST_TEST(enum_count_v<Flag> == 2u);
+    BOOST_TEST(enum_name(Off) == "Off");
+    BOOST_TEST(detail::range_max<Below> == -5);
+    BOOST_TEST(enum_count_v<Below> == 1u);
+    BOOST_TEST(enum_name(Below::Low) == "Low");
+
+    static_assert(enum_cast<Op>("div") == Op::div);
+    BOOST_TEST(bool(enum_cast<Op>("add") == Op::add) == true);
+    BOOST_TEST(bool(enum_cast<Op>("sub") == Op::sub) == true);
+    BOOST_TEST(bool(enum_cast<Op>("mul").has_value()) == false);
+    BOOST_TEST(detail::name_index<Op>.seed != 0u);
+    BOOST_TEST(enum_name(Second) == "Second");
+    BOOST_TEST(enum_name(static_cast<Color>(42)).empty() == true);
+    BOOST_TEST(bool(enum_cast<Color>("Blue") == Color::Blue) == true);
+    BOOST_TEST(bool(enum_cast<Color>("Purple").has_value()) == false);
+    BOOST_TEST(bool(enum_cast<Color>("").has_value()) == false);
+
+    BOOST_TEST(enum_count_v<Opcode> == 4u);
+    BOOST_TEST(enum_name(Opcode::Jump) == "Jump");
+    BOOST_TEST(bool(enum_cast<Opcode>("Store") == Opcode::Store) == true);
+    for (std::size_t i = 0; i < enum_count_v<Opcode>; ++i) {
+        BOOST_TEST(bool(enum_cast<Opcode>(enum_names_v<Opcode>[i]) == enum_values_v<Opcode>[i]) == true);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_static_map) {
+    using namespace containers;
+
+    TEST_LOG();
+
+    constexpr auto opcodes = make_static_map<unsigned int, int>({{0x10u, 1}, {0x2au, 2}, {0xffffu, 3}, {7u, 4}});
+    static_assert(opcodes.size() == 4);
+    static_assert(*opcodes.find(0x2au) == 2);
+    static_assert(opcodes.find(8u) == nullptr);
+
+    BOOST_TEST(opcodes.at(0xffffu) == 3);
+    BOOST_TEST(opcodes.contains(7u) == true);
+    BOOST_TEST(opcodes.contains(0u) == false);
+    BOOST_CHECK_THROW(opcodes.at(1u), std::out_of_range);
+
+    constexpr auto config = make_static_map<std::string_view, int>({
+        {"threads", 1}, {"timeout_ms", 2}, {"log_level", 3}, {"listen_address", 4}, {"", 5}});
+    static_assert(config.at("log_level") == 3);
+
+    BOOST_TEST(config.at("listen_address") == 4);
+    BOOST_TEST(config.at("") == 5);
+    BOOST_TEST(config.contains("thread") == false);
+    BOOST_TEST(config.contains("timeout_msx") == false);
+
+    int sum = 0;
+    for (const auto& entry : config) {
+        sum += entry.second;
+    }
+    BOOST_TEST(sum == 15);
+
+    /*Two of these collide for every displacement under the unseeded hash*/
+    constexpr auto arithmetic = make_static_map<std::string_view, int>({{"add", 1}, {"sub", 2}, {"div", 3}});
+    static_assert(arithmetic.at("add") == 1 && arithmetic.at("sub") == 2 && arithmetic.at("div") == 3);
+    BOOST_TEST(arithmetic.contains("mul") == false);
+
+    constexpr auto colors = make_static_map<enum_test::Color, char>({
+        {enum_test::Color::Red, 'r'}, {enum_test::Color::Blue, 'b'}});
+    BOOST_TEST(colors.at(enum_test::Color::Blue) == 'b');
+    BOOST_TEST(colors.contains(enum_test::Color::Green) == false);
+}
+
+BOOST_AUTO_TEST_CASE(test_atomic_storage) {
+    using namespace concurrency;
+    using namespace type_relationships;
+
+    TEST_LOG();
+
+    struct Small { std::uint32_t a, b; };
+    struct Snapshot { std::uint64_t values[6]; };
+
+    static_assert(is_same_v<atomic_storage<Small>, atomic_cell<Small>>);
+    static_assert(is_same_v<atomic_storage<std::uint64_t>, atomic_cell<std::uint64_t>>);
+    static_assert(is_same_v<atomic_storage<Snapshot>, seqlock_cell<Snapshot>>);
+
+    atomic_storage<Small> small(Small{1, 2});
+    BOOST_TEST(small.load().b == 2u);
+    small.store(Small{3, 4});
+    BOOST_TEST(small.load().a == 3u);
+
+    atomic_storage<Snapshot> snapshot;
+    BOOST_TEST(snapshot.load().values[5] == 0u);
+
+    /*Every published snapshot has equal fields, a torn read would not*/
+    constexpr std::uint64_t writes = 20000;
+    std::atomic<bool> torn{false};
+    std::thread writer([&] {
+        for (std::uint64_t k = 1; k <= writes; ++k) {
+            snapshot.store(Snapshot{{k, k, k, k, k, k}});
+        }
+    });
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            std::uint64_t last = 0;
+            while (last != writes) {
+                Snapshot s = snapshot.load();
+                for (std::uint64_t v : s.values) {
+                    if (v != s.values[0]) {
+                        torn = true;
+                    }
+                }
+                last = s.values[0];
+            }
+        });
+    }
+    writer.join();
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    BOOST_TEST(torn.load() == false);
+}
+
+BOOST_AUTO_TEST_CASE(test_ring_buffer) {
+    using namespace concurrency;
+    using namespace type_relationships;
+
+    TEST_LOG();
+
+    static_assert(is_same_v<ring_slot<int>, inline_slot<int>>);
+    static_assert(is_same_v<ring_slot<void*>, inline_slot<void*>>);
+    static_assert(is_same_v<ring_slot<std::string>, constructed_slot<std::string>>);
+
+    spsc_ring_buffer<int, 4> spsc;
+    int value = 0;
+    BOOST_TEST(spsc.try_pop(value) == false);
+    for (int i = 0; i < 4; ++i) {
+        BOOST_TEST(spsc.try_push(i) == true);
+    }
+    BOOST_TEST(spsc.try_push(4) == false);
+    BOOST_TEST((spsc.try_pop(value) && value == 0) == true);
+    BOOST_TEST(spsc.try_push(4) == true);
+    for (int i = 1; i <= 4; ++i) {
+        BOOST_TEST((spsc.try_pop(value) && value == i) == true);
+    }
+
+    /*Elements left in the queue are destroyed with it*/
+    auto tracked = std::make_shared<int>(0);
+    {
+        mpmc_ring_buffer<std::shared_ptr<int>, 8> mpmc;
+        BOOST_TEST(mpmc.try_push(tracked) == true);
+        BOOST_TEST(mpmc.try_emplace(tracked) == true);
+        BOOST_TEST(tracked.use_count() == 3);
+        std::shared_ptr<int> out;
+        BOOST_TEST(mpmc.try_pop(out) == true);
+        out.reset();
+        BOOST_TEST(tracked.use_count() == 2);
+    }
+    BOOST_TEST(tracked.use_count() == 1);
+
+    mpmc_ring_buffer<std::string, 2> strings;
+    BOOST_TEST(strings.try_push(std::string(64, 'x')) == true);
+    std::string text;
+    BOOST_TEST((strings.try_pop(text) && text.size() == 64u) == true);
+
+    /*A constructor that throws leaves no claimed cell behind*/
+    BOOST_CHECK_THROW(strings.try_emplace(std::string::npos, 'x'), std::length_error);
+    BOOST_TEST(strings.try_emplace(3u, 'y') == true);
+    BOOST_TEST(strings.try_emplace(4u, 'z') == true);
+    BOOST_TEST((strings.try_pop(text) && text == "yyy") == true);
+    BOOST_TEST((strings.try_pop(text) && text == "zzzz") == true);
+
+    /*Every produced value is consumed exactly once*/
+    constexpr std::uint64_t per_producer = 20000;
+    mpmc_ring_buffer<std::uint64_t, 64> queue;
+    std::atomic<std::uint64_t> sum{0};
+    std::atomic<std::uint64_t> consumed{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < 2; ++p) {
+        threads.emplace_back([&] {
+            for (std::uint64_t i = 1; i <= per_producer; ++i) {
+                while (!queue.try_push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        threads.emplace_back([&] {
+            std::uint64_t item = 0;
+            while (consumed.load() < 2 * per_producer) {
+                if (queue.try_pop(item)) {
+                    sum += item;
+                    ++consumed;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    BOOST_TEST(sum.load() == per_producer * (per_producer + 1));
+}
+
+BOOST_AUTO_TEST_CASE(test_fast_cast) {
+    using namespace hierarchy;
+    using namespace hierarchy_test;
+
+    TEST_LOG();
+
+    static_assert(static_hierarchy_id<Shape>() == 0);
+    static_assert(class_hierarchy_t<Square>::interval_of<Polygon>().size == 3);
+    static_assert(class_hierarchy_t<Square>::interval_of<Circle>().size == 1);
+
+    Triangle triangle;
+    Square square;
+    Circle circle;
+    Shape plain(7);
+
+    Shape* shapes[] = {&triangle, &square, &circle, &plain};
+    BOOST_TEST(triangle.sides == 4);
+    BOOST_TEST(shapes[0]->dynamic_hierarchy_id() == static_hierarchy_id<Triangle>());
+    BOOST_TEST(fast_cast<Polygon>(shapes[0]) == static_cast<Polygon*>(&triangle));
+    BOOST_TEST(fast_cast<Polygon>(shapes[1]) == static_cast<Polygon*>(&square));
+    BOOST_TEST(fast_cast<Polygon>(shapes[2]) == nullptr);
+    BOOST_TEST(fast_cast<Polygon>(shapes[3]) == nullptr);
+    BOOST_TEST(fast_cast<Square>(shapes[0]) == nullptr);
+    BOOST_TEST(fast_cast<Circle>(shapes[2]) == &circle);
+    BOOST_TEST(fast_cast<Shape>(shapes[3]) == &plain);
+
+    const Shape* constant = &square;
+    BOOST_TEST(fast_cast<Square>(constant) == &square);
+    BOOST_TEST(fast_cast<Square>(static_cast<Shape*>(nullptr)) == nullptr);
+
+    for (Shape* shape : shapes) {
+        BOOST_TEST((fast_cast<Polygon>(shape) == dynamic_cast<Polygon*>(shape)) == true);
+        BOOST_TEST((fast_cast<Triangle>(shape) == dynamic_cast<Triangle*>(shape)) == true);
+    }
+
+    /*A copy is stamped by its own class, not by the class it was copied from*/
+    Shape sliced(square);
+    Polygon polygon(square);
+    Square copied(square);
+    Square moved(std::move(copied));
+    BOOST_TEST(sliced.dynamic_hierarchy_id() == static_hierarchy_id<Shape>());
+    BOOST_TEST(fast_cast<Square>(static_cast<Shape*>(&sliced)) == nullptr);
+    BOOST_TEST(polygon.dynamic_hierarchy_id() == static_hierarchy_id<Polygon>());
+    BOOST_TEST(copied.dynamic_hierarchy_id() == static_hierarchy_id<Square>());
+    BOOST_TEST(moved.dynamic_hierarchy_id() == static_hierarchy_id<Square>());
+
+    /*Assignment through a base reference keeps the dynamic type of the target*/
+    Circle target;
+    Shape& through_base = target;
+    through_base = square;
+    BOOST_TEST(target.dynamic_hierarchy_id() == static_hierarchy_id<Circle>());
+    BOOST_TEST(fast_cast<Square>(&through_base) == nullptr);
+    BOOST_TEST(fast_cast<Circle>(&through_base) == &target);
+    Square assigned;
+    assigned = square;
+    BOOST_TEST(assigned.dynamic_hierarchy_id() == static_hierarchy_id<Square>());
+}
+
+BOOST_AUTO_TEST_CASE(test_hashing) {
+    using namespace hashing;
+    using namespace hashing_test;
+
+    TEST_LOG();
+
+    static_assert(has_unique_object_representations_v<JoinKey>);
+    static_assert(has_hash_members_v<PaddedKey>);
+    static_assert(has_hash_members_v<JoinKey> == false);
+
+    JoinKey a{42, 7, 3};
+    JoinKey b{42, 7, 3};
+    JoinKey c{42, 7, 4};
+    BOOST_TEST(hash_value(a) == hash_value(b));
+    BOOST_TEST(hash_value(a) != hash_value(c));
+    BOOST_TEST(hash_value(a) == hash_bytes(&b, sizeof(b)));
+
+    JoinKey keys[3] = {a, b, c};
+    BOOST_TEST(hash_value(keys) == hash_bytes(keys, sizeof(keys)));
+
+    /*Padding bytes must not leak into the hash*/
+    alignas(PaddedKey) unsigned char zeros[sizeof(PaddedKey)];
+    alignas(PaddedKey) unsigned char ones[sizeof(PaddedKey)];
+    std::memset(zeros, 0x00, sizeof(zeros));
+    std::memset(ones, 0xff, sizeof(ones));
+    PaddedKey* p1 = new (zeros) PaddedKey{'x', 9, 0.0, "widget"};
+    PaddedKey* p2 = new (ones) PaddedKey{'x', 9, -0.0, "widget"};
+    BOOST_TEST(hash_value(*p1) == hash_value(*p2));
+    p2->name = "gadget";
+    BOOST_TEST(hash_value(*p1) != hash_value(*p2));
+    p1->~PaddedKey();
+    p2->~PaddedKey();
+
+    /*Every length takes a different load path*/
+    unsigned char bytes[200];
+    for (std::size_t i = 0; i < sizeof(bytes); ++i) {
+        bytes[i] = static_cast<unsigned char>(i * 31);
+    }
+    std::vector<std::uint64_t> hashes;
+    for (std::size_t n = 0; n <= sizeof(bytes); ++n) {
+        hashes.push_back(hash_bytes(bytes, n));
+    }
+    std::sort(hashes.begin(), hashes.end());
+    BOOST_TEST((std::adjacent_find(hashes.begin(), hashes.end()) == hashes.end()) == true);
+
+    /*Between 16 and 32 bytes, the leading bytes count as much as the trailing ones*/
+    for (std::size_t n = 17; n < 32; ++n) {
+        unsigned char changed[32];
+        std::memcpy(changed, bytes, n);
+        changed[0] ^= 1;
+        BOOST_TEST(hash_bytes(bytes, n) != hash_bytes(changed, n));
+        std::memcpy(changed, bytes, n);
+        changed[n - 17] ^= 0x80;
+        BOOST_TEST(hash_bytes(bytes, n) != hash_bytes(changed, n));
+    }
+
+    std::unordered_map<JoinKey, int, hasher<JoinKey>, bool (*)(const JoinKey&, const JoinKey&)> joined(
+        8, hasher<JoinKey>{}, [](const JoinKey& l, const JoinKey& r) { return std::memcmp(&l, &r, sizeof(l)) == 0; });
+    joined[a] = 1;
+    BOOST_TEST(joined.count(b) == 1u);
+    BOOST_TEST(joined.count(c) == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(test_algorithms) {
+    using namespace algorithms;
+    using hashing_test::JoinKey;
+
+    TEST_LOG();
+
+    static_assert(is_memset_fillable_v<unsigned char*, int>);
+    static_assert(is_memset_fillable_v<int*, int> == false);
+    static_assert(is_memset_fillable_v<const char*, char> == false);
+    static_assert(is_memmove_copyable_v<const JoinKey*, JoinKey*>);
+    static_assert(is_memmove_copyable_v<const int*, long*> == false);
+    struct Fixed { const int x; };
+    static_assert(is_memmove_copyable_v<const Fixed*, Fixed*> == false);
+    static_assert(supported_operations::is_trivially_assignable_v<int&, const int&>);
+    static_assert(supported_operations::is_assignable_v<Fixed&, const Fixed&> == false);
+    static_assert(is_memmove_copyable_v<std::vector<int>::iterator, int*> == false);
+    static_assert(is_memcmp_equality_comparable_v<const int*, int*>);
+    static_assert(is_memcmp_equality_comparable_v<const float*, const float*> == false);
+    static_assert(is_memcmp_ordered_v<const unsigned char*, unsigned char*>);
+    static_assert(is_memcmp_ordered_v<const signed char*, const signed char*> == false);
+
+    unsigned char bytes[8];
+    algorithms::fill(bytes, bytes + 8, 0x7f);
+    BOOST_TEST((bytes[0] == 0x7f && bytes[7] == 0x7f) == true);
+
+    static_assert(is_memset_fillable_v<bool*, int>);
+    bool flags[4];
+    unsigned char representation = 0;
+    for (int value : {2, 256, -1}) {
+        algorithms::fill(flags, flags + 4, value);
+        std::memcpy(&representation, &flags[3], 1);
+        BOOST_TEST(representation == 1);
+    }
+    algorithms::fill(flags, flags + 4, 0);
+    BOOST_TEST((flags[0] || flags[3]) == false);
+
+    std::string text(5, ' ');
+    algorithms::fill(text.begin(), text.end(), 'z');
+    BOOST_TEST(text == "zzzzz");
+
+    int numbers[6] = {1, 2, 3, 4, 5, 6};
+    int copied[6] = {};
+    BOOST_TEST(algorithms::copy(numbers, numbers + 6, copied) == copied + 6);
+    BOOST_TEST(algorithms::equal(numbers, numbers + 6, copied) == true);
+    copied[5] = 7;
+    BOOST_TEST(algorithms::equal(numbers, numbers + 6, copied) == false);
+
+    /*Overlapping shift to the left*/
+    algorithms::copy(numbers + 1, numbers + 6, numbers);
+    BOOST_TEST((numbers[0] == 2 && numbers[4] == 6) == true);
+
+    std::vector<std::string> words = {"a", "b"};
+    std::vector<std::string> out(2);
+    algorithms::copy(words.begin(), words.end(), out.begin());
+    BOOST_TEST(algorithms::equal(words.begin(), words.end(), out.begin()) == true);
+
+    float zeros[2] = {0.0f, 0.0f};
+    float negative_zeros[2] = {-0.0f, -0.0f};
+    BOOST_TEST(algorithms::equal(zeros, zeros + 2, negative_zeros) == true);
+
+    const unsigned char low[] = {1, 2, 200};
+    const unsigned char high[] = {1, 2, 201};
+    BOOST_TEST(algorithms::compare(low, low + 3, high, high + 3) < 0);
+    BOOST_TEST(algorithms::compare(high, high + 3, low, low + 3) > 0);
+    BOOST_TEST(algorithms::compare(low, low + 2, low, low + 3) < 0);
+    BOOST_TEST(algorithms::compare(low, low + 3, low, low + 3) == 0);
+
+    const signed char negative[] = {-1};
+    const signed char positive[] = {1};
+    BOOST_TEST(algorithms::compare(negative, negative + 1, positive, positive + 1) < 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_function_traits) {
+    using namespace callables;
+    using namespace type_relationships;
+    using namespace callables_test;
+
+    TEST_LOG();
+
+    using add_traits = function_traits<decltype(&add)>;
+    static_assert(add_traits::arity == 2);
+    static_assert(add_traits::is_noexcept);
+    static_assert(add_traits::is_member == false);
+    static_assert(is_same_v<add_traits::return_type, int>);
+    static_assert(is_same_v<add_traits::signature, int(int, int)>);
+
+    using scaled_traits = function_traits<decltype(&Physics::scaled)>;
+    static_assert(scaled_traits::is_member);
+    static_assert(scaled_traits::is_const);
+    static_assert(scaled_traits::ref == ref_qualifier::lvalue);
+    static_assert(is_same_v<scaled_traits::class_type, Physics>);
+    static_assert(is_same_v<arg_t<decltype(&Physics::scaled), 0>, int>);
+
+    static_assert(function_traits<int(const char*, ...)>::is_variadic);
+    static_assert(function_traits<void() volatile && noexcept>::ref == ref_qualifier::rvalue);
+    static_assert(function_traits<void() volatile && noexcept>::is_volatile);
+
+    auto lambda = [](double, const std::string&) { return 'c'; };
+    static_assert(arity_v<decltype(lambda)> == 2);
+    static_assert(is_same_v<return_type_t<decltype(lambda)>, char>);
+    static_assert(is_same_v<arg_t<decltype(lambda)&, 1>, const std::string&>);
+
+    auto sum = make_delegate<&add>();
+    BOOST_TEST(sum(2, 3) == 5);
+
+    Physics physics;
+    auto scale = make_delegate<&Physics::scaled>(physics);
+    BOOST_TEST(scale(21) == 42);
+
+    int captured = 10;
+    auto offset = [&captured](int value) { return value + captured; };
+    auto bound = delegate<int(int)>::bind(offset);
+    captured = 20;
+    BOOST_TEST(bound(1) == 21);
+
+    delegate<void()> empty;
+    BOOST_TEST(bool(empty) == false);
+    BOOST_TEST(bool(bound) == true);
+}
+
+BOOST_AUTO_TEST_CASE(test_event_bus) {
+    using namespace callables;
+    using namespace callables_test;
+
+    TEST_LOG();
+
+    Physics physics;
+    Renderer renderer;
+    auto bus = make_event_bus<&log_tick, &Physics::on_tick, &Physics::on_collision, &Renderer::on_tick>(physics, renderer);
+
+    static_assert(decltype(bus)::subscriber_count<Tick>() == 3);
+    static_assert(decltype(bus)::subscriber_count<Collision>() == 1);
+    static_assert(decltype(bus)::subscriber_count<int>() == 0);
+
+    ticks_logged = 0;
+    bus.publish(Tick{7});
+    bus.publish(Tick{8});
+    bus.publish(Collision{1, 2});
+    bus.publish(42);
+
+    BOOST_TEST(ticks_logged == 2);
+    BOOST_TEST(physics.last_frame == 8);
+    BOOST_TEST(physics.collisions == 1);
+    BOOST_TEST(renderer.frames == 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_soa_vector) {
+    using namespace containers;
+
+    TEST_LOG();
+
+    struct Order { std::uint64_t id; double price; std::uint32_t quantity; std::string venue; };
+
+    soa_vector<Order> orders;
+    BOOST_TEST(orders.empty() == true);
+    orders.reserve(4);
+    orders.push_back(Order{1, 10.5, 3, "XNYS"});
+    orders.push_back(Order{2, 20.0, 5, "XLON"});
+    orders.push_back(Order{3, 30.25, 7, "XTKS"});
+    BOOST_TEST(orders.size() == 3u);
+
+    const std::vector<double>& prices = orders.column<1>();
+    BOOST_TEST(prices.size() == 3u);
+    BOOST_TEST(prices[2] == 30.25);
+
+    orders[1].get<2>() = 6;
+    BOOST_TEST(orders.column<2>()[1] == 6u);
+
+    Order second = orders[1];
+    BOOST_TEST(second.venue == "XLON");
+    BOOST_TEST(second.quantity == 6u);
+
+    orders[0] = Order{9, 1.0, 1, "BATS"};
+    BOOST_TEST(orders.column<0>()[0] == 9u);
+    BOOST_TEST(orders.column<3>()[0] == "BATS");
+
+    double total = 0;
+    for (auto order : orders) {
+        total += order.get<1>();
+    }
+    BOOST_TEST(total == 51.25);
+
+    const soa_vector<Order>& view = orders;
+    BOOST_TEST(static_cast<Order>(view[2]).id == 3u);
+
+    orders.clear();
+    BOOST_TEST(orders.size() == 0u);
+
+    /*bool fields get a byte each, and real bool& through the proxy*/
+    static_assert(sizeof(bool_cell) == sizeof(bool));
+    struct Fill { std::uint32_t quantity; bool aggressive; };
+    soa_vector<Fill> fills;
+    fills.push_back(Fill{10, true});
+    fills.push_back(Fill{20, false});
+    fills[1].get<1>() = true;
+    BOOST_TEST(fills.column<1>()[1].value == true);
+    BOOST_TEST(static_cast<Fill>(fills[0]).aggressive == true);
+
+    /*A field that throws on copy leaves no column longer than the others*/
+    struct Refusing {
+        Refusing() = default;
+        Refusing(const Refusing& other) : fail(other.fail) {
+            if (fail) {
+                throw std::runtime_error("refused");
+            }
+        }
+        Refusing& operator=(const Refusing&) = default;
+        bool fail = false;
+    };
+    struct Row { std::uint64_t id; Refusing payload; std::string name; };
+    soa_vector<Row> rows;
+    rows.push_back(Row{1, Refusing{}, "first"});
+    Row bad{2, Refusing{}, "second"};
+    bad.payload.fail = true;
+    BOOST_CHECK_THROW(rows.push_back(bad), std::runtime_error);
+    BOOST_TEST(rows.size() == 1u);
+    BOOST_TEST(rows.column<0>().size() == 1u);
+    BOOST_TEST(rows.column<1>().size() == 1u);
+    BOOST_TEST(rows.column<2>().size() == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(test_packed_int_array) {
+    using namespace containers;
+    using namespace type_relationships;
+
+    TEST_LOG();
+
+    static_assert(is_same_v<packed_int_array<7>::value_type, std::uint8_t>);
+    static_assert(is_same_v<packed_int_array<10>::value_type, std::uint16_t>);
+    static_assert(is_same_v<packed_int_array<20>::value_type, std::uint32_t>);
+    static_assert(is_same_v<packed_int_array<40>::value_type, std::uint64_t>);
+
+    constexpr std::size_t count = 1000;
+    packed_int_array<17> codes(count);
+    BOOST_TEST(codes.size() == count);
+    BOOST_TEST(codes.memory_bytes() < count * sizeof(std::uint32_t) / 1.8);
+
+    std::vector<std::uint32_t> expected(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        expected[i] = static_cast<std::uint32_t>((i * 2654435761u) & packed_int_array<17>::max_value);
+        codes.set(i, expected[i]);
+    }
+    bool all = true;
+    for (std::size_t i = 0; i < count; ++i) {
+        all = all && codes.get(i) == expected[i];
+    }
+    BOOST_TEST(all == true);
+
+    /*Unaligned head, full blocks and tail*/
+    std::vector<std::uint32_t> out(count);
+    codes.unpack(3, count - 5, out.data());
+    BOOST_TEST(std::equal(out.begin(), out.begin() + (count - 5), expected.begin() + 3) == true);
+
+    /*Neighbours survive a write*/
+    codes.set(500, packed_int_array<17>::max_value);
+    BOOST_TEST(codes.get(499) == expected[499]);
+    BOOST_TEST(codes.get(500) == packed_int_array<17>::max_value);
+    BOOST_TEST(codes.get(501) == expected[501]);
+
+    packed_int_array<3> small(20);
+    std::uint8_t values[20];
+    for (std::uint8_t i = 0; i < 20; ++i) {
+        values[i] = i % 8;
+    }
+    small.pack(0, 20, values);
+    std::uint8_t round_trip[20];
+    small.unpack(0, 20, round_trip);
+    BOOST_TEST(std::memcmp(values, round_trip, 20) == 0);
+
+    /*Batch packing matches set() around an unaligned head and tail*/
+    packed_int_array<17> packed(count);
+    packed.pack(5, count - 9, expected.data() + 5);
+    all = packed.get(4) == 0 && packed.get(count - 4) == 0;
+    for (std::size_t i = 5; i < count - 4; ++i) {
+        all = all && packed.get(i) == expected[i];
+    }
+    BOOST_TEST(all == true);
+
+    /*Shrinking clears what it drops, growing again reads zeros*/
+    packed_int_array<10> shrunk(8);
+    for (std::size_t i = 0; i < 8; ++i) {
+        shrunk.set(i, 1000);
+    }
+    shrunk.resize(4);
+    shrunk.resize(8);
+    BOOST_TEST(shrunk.get(3) == 1000);
+    BOOST_TEST(shrunk.get(4) == 0);
+    BOOST_TEST(shrunk.get(5) == 0);
+    BOOST_TEST(shrunk.get(7) == 0);
+}
+
+namespace tagged_ptr_test {
+    /*Intrusive list node marking itself through the tag, no separate state byte*/
+    struct alignas(8) Node {
+        int value = 0;
+        concurrency::tagged_ptr<Node, 3> next;
+    };
+}
+
+BOOST_AUTO_TEST_CASE(test_tagged_ptr) {
+    using namespace concurrency;
+    using namespace type_relationships;
+    using tagged_ptr_test::Node;
+
+    TEST_LOG();
+
+    static_assert(is_same_v<tagged_ptr<Node*, 3>::element_type, Node>);
+    static_assert(sizeof(tagged_ptr<Node, 3>) == sizeof(Node*));
+    static_assert(sizeof(Node) == 2 * sizeof(Node*));
+
+    Node first{1, nullptr};
+    Node second{2, nullptr};
+    tagged_ptr<Node, 3> ptr(&first, 5);
+    BOOST_TEST(ptr.get() == &first);
+    BOOST_TEST(ptr.tag() == 5u);
+    BOOST_TEST(ptr->value == 1);
+
+    ptr.set(&second);
+    BOOST_TEST(ptr.get() == &second);
+    BOOST_TEST(ptr.tag() == 5u);
+    ptr.set_tag(9);
+    BOOST_TEST(ptr.tag() == 1u);
+    BOOST_TEST((*ptr).value == 2);
+
+    /*The counter wraps inside its bits and never reaches the pointer*/
+    tagged_ptr<Node, 3> wrapped(&first, 7);
+    BOOST_TEST(wrapped.next_tag(&first).tag() == 0u);
+    BOOST_TEST(wrapped.next_tag(&first).get() == &first);
+
+    first.next = tagged_ptr<Node, 3>(&second, 1);
+    BOOST_TEST(first.next->value == 2);
+    BOOST_TEST(bool(tagged_ptr<Node, 3>()) == false);
+
+    /*Same pointer, other tag : compare_exchange sees the ABA*/
+    atomic_tagged_ptr<Node, 3> head(tagged_ptr<Node, 3>(&first, 0));
+    tagged_ptr<Node, 3> stale = head.load();
+    head.store(stale.next_tag(&second));
+    head.store(head.load().next_tag(&first));
+    BOOST_TEST(head.load().get() == stale.get());
+    BOOST_TEST(head.compare_exchange_strong(stale, stale.next_tag(&second)) == false);
+    BOOST_TEST(stale.tag() == 2u);
+    BOOST_TEST(head.compare_exchange_strong(stale, stale.next_tag(&second)) == true);
+    BOOST_TEST(head.load().get() == &second);
+    BOOST_TEST(head.load().tag() == 3u);
+
+    /*Concurrent tag increments are never lost*/
+    atomic_tagged_ptr<Node, 3> counter(tagged_ptr<Node, 3>(&first, 0));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&counter] {
+            for (int i = 0; i < 1000; ++i) {
+                tagged_ptr<Node, 3> expected = counter.load();
+                while (!counter.compare_exchange_weak(expected, expected.next_tag(expected.get()))) { }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    BOOST_TEST(counter.load().tag() == 4000u % 8);
+    BOOST_TEST(counter.load().get() == &first);
+}
+
+namespace instrumentation_test {
+    std::unique_ptr<std::vector<int>> bench_sink;
+}
+
+BOOST_AUTO_TEST_CASE(test_instrumentation) {
+    using namespace instrumentation;
+    using instrumentation_test::bench_sink;
+
+    TEST_LOG();
+
+    /*Samples of this test go to a local recorder, not to the process-wide report*/
+    recorder local;
+    sample result;
+    {
+        scope measured("allocating", 3, local);
+        for (int i = 0; i < 3; ++i) {
+            bench_sink = std::make_unique<std::vector<int>>(1000, i);
+        }
+        result = measured.measure();
+    }
+    BOOST_TEST(result.name == "allocating");
+    BOOST_TEST(result.iterations == 3u);
+    BOOST_TEST(result.allocations >= 6u);
+    BOOST_TEST(result.wall_ns > 0);
+    BOOST_TEST(result.cpu_ns >= 0);
+    /*Enabled counters may still be refused by the kernel (perf_event_paranoid)*/
+    if (!local.counters_enabled()) {
+        BOOST_TEST(result.has_counters == false);
+    }
+
+    /*measure() stopped the scope : nothing recorded for it*/
+    BOOST_TEST(local.samples().empty() == true);
+
+    {
+        scope recorded("recorded \"scope\"", 1, local);
+    }
+    std::vector<sample> samples = local.samples();
+    BOOST_TEST(samples.size() == 1u);
+    BOOST_TEST(samples.back().name == "recorded \"scope\"");
+    BOOST_TEST(samples.back().allocations == 0u);
+    samples = recorder::instance().samples();
+    BOOST_TEST(std::none_of(samples.begin(), samples.end(), [](const sample& s) { return s.name == "recorded \"scope\""; }));
+
+    sample empty;
+    empty.name = "no iterations";
+    empty.iterations = 0;
+    empty.wall_ns = 2888180;
+    BOOST_TEST(empty.ns_per_op() == 0);
+    local.add(empty);
+
+    std::ostringstream csv;
+    local.write(csv, format::csv);
+    BOOST_TEST(csv.str().rfind("name,iterations,wall_ns,cpu_ns,ns_per_op,allocations,cycles", 0) == 0u);
+    BOOST_TEST(csv.str().find("\"recorded \"\"scope\"\"\"") != std::string::npos);
+    BOOST_TEST(csv.str().find("\"no iterations\",0,2888180.00,0.00,0.00,0") != std::string::npos);
+    BOOST_TEST(csv.str().find("e+") == std::string::npos);
+
+    std::ostringstream json;
+    json << 0.5;
+    local.write(json, format::json);
+    json << 0.5;
+    BOOST_TEST(json.str().rfind("0.5[", 0) == 0u);
+    BOOST_TEST(json.str().find("\"name\": \"recorded \\\"scope\\\"\"") != std::string::npos);
+    BOOST_TEST(json.str().find("\"wall_ns\": 2888180.00") != std::string::npos);
+    BOOST_TEST(json.str().find("]\n0.5") != std::string::npos);
+}
+
+namespace object_pool_test {
+    struct Request {
+        std::uint64_t id;
+        std::uint32_t bytes;
+    };
+
+    struct Connection {
+        static inline int alive = 0;
+
+        explicit Connection(std::string peer) : peer(std::move(peer)) { ++alive; }
+        ~Connection() { --alive; }
+
+        std::string peer;
+    };
+
+    struct Refused {
+        explicit Refused(bool fail) {
+            if (fail) {
+                throw std::runtime_error("refused");
+            }
+        }
+    };
+}
+
+BOOST_AUTO_TEST_CASE(test_object_pool) {
+    using namespace containers;
+    using object_pool_test::Request;
+    using object_pool_test::Connection;
+
+    TEST_LOG();
+
+    static_assert(object_pool<Request>::reuses_storage);
+    static_assert(!object_pool<Connection>::reuses_storage);
+
+    /*Freed storage comes straight back from the thread's cache*/
+    object_pool<Request> requests;
+    Request* first = requests.create(Request{7, 512});
+    BOOST_TEST(first->id == 7u);
+    BOOST_TEST(first->bytes == 512u);
+    requests.destroy(first);
+    Request* again = requests.create();
+    BOOST_TEST(again == first);
+    requests.destroy(again);
+    BOOST_TEST(requests.slab_count() == 1u);
+
+    /*Aggregates without a matching constructor are brace-initialized*/
+    Request* braced = requests.create(std::uint64_t(9), std::uint32_t(64));
+    BOOST_TEST(braced->id == 9u);
+    requests.destroy(braced);
+
+    object_pool<Connection> connections;
+    std::vector<Connection*> open;
+    for (int i = 0; i < 1000; ++i) {
+        open.push_back(connections.create("peer-" + std::to_string(i)));
+    }
+    BOOST_TEST(Connection::alive == 1000);
+    BOOST_TEST(open[999]->peer == "peer-999");
+    BOOST_TEST(connections.slab_count() == (1000 + object_pool<Connection>::slab_objects - 1) / object_pool<Connection>::slab_objects);
+    for (Connection* connection : open) {
+        connections.destroy(connection);
+    }
+    BOOST_TEST(Connection::alive == 0);
+
+    /*A constructor that throws hands its slot back*/
+    object_pool<object_pool_test::Refused> refusing;
+    auto* kept = refusing.create(false);
+    refusing.destroy(kept);
+    BOOST_CHECK_THROW(refusing.create(true), std::runtime_error);
+    BOOST_TEST(refusing.create(false) == kept);
+
+    /*Objects created on one thread and destroyed on another, never handed out twice*/
+    object_pool<Request> shared;
+    constexpr int threads_count = 4;
+    constexpr int rounds = 2000;
+    std::vector<std::vector<Request*>> created(threads_count);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t) {
+        threads.emplace_back([&shared, &created, t] {
+            std::vector<Request*> mine;
+            for (int i = 0; i < rounds; ++i) {
+                mine.push_back(shared.create(Request{static_cast<std::uint64_t>(t), static_cast<std::uint32_t>(i)}));
+                if (i % 3 == 2) {
+                    shared.destroy(mine[mine.size() - 2]);
+                    mine.erase(mine.end() - 2);
+                }
+            }
+            created[t] = std::move(mine);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::vector<Request*> all;
+    bool intact = true;
+    for (int t = 0; t < threads_count; ++t) {
+        for (Request* request : created[t]) {
+            intact = intact && request->id == static_cast<std::uint64_t>(t);
+            all.push_back(request);
+        }
+    }
+    BOOST_TEST(intact == true);
+    std::sort(all.begin(), all.end());
+    BOOST_TEST(bool(std::adjacent_find(all.begin(), all.end()) == all.end()) == true);
+
+    /*Freed on this thread, reused by the next creates*/
+    threads.clear();
+    threads.emplace_back([&shared, &all] {
+        for (Request* request : all) {
+            shared.destroy(request);
+        }
+    });
+    threads.back().join();
+    std::size_t slabs = shared.slab_count();
+    std::vector<Request*> reused;
+    for (std::size_t i = 0; i < all.size(); ++i) {
+        reused.push_back(shared.create());
+    }
+    BOOST_TEST(shared.slab_count() == slabs);
+    for (Request* request : reused) {
+        shared.destroy(request);
+    }
+
+    /*Each exiting thread hands its cache back : short-lived threads do not grow the pool*/
+    object_pool<Request> churned;
+    for (std::size_t t = 0; t < 2 * object_pool<Request>::slab_objects / object_pool<Request>::cache_batch; ++t) {
+        std::thread([&churned] { churned.destroy(churned.create()); }).join();
+    }
+    BOOST_TEST(churned.slab_count() == 1u);
+}
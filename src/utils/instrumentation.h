@@ -0,0 +1,382 @@
+#ifndef INCLUDE_INSTRUMENTATION_H
+#define INCLUDE_INSTRUMENTATION_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*
+ * Measurements shared by the tests and the benchmarks : wall time, process CPU time,
+ * heap allocations and hardware counters of a scope, buffered and written out once, at exit.
+ *
+ * Environment :
+ *     INSTRUMENTATION_REPORT   file to write the report to, standard output when unset
+ *     INSTRUMENTATION_FORMAT   csv (default) or json
+ *     INSTRUMENTATION_COUNTERS 1 to read cycles, instructions, cache and branch misses
+ *                              through perf_event_open (Linux, calling thread only)
+ *
+ * Allocations are counted when one translation unit defines INSTRUMENTATION_COUNT_ALLOCATIONS
+ * before including this header, which replaces the global operator new and delete there.
+ */
+namespace instrumentation {
+    inline std::uint64_t wall_ns() noexcept {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /*CPU time of the whole process, every thread included*/
+    inline std::uint64_t cpu_ns() noexcept {
+#if defined(CLOCK_PROCESS_CPUTIME_ID)
+        timespec now;
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+        return static_cast<std::uint64_t>(now.tv_sec) * 1000000000u + static_cast<std::uint64_t>(now.tv_nsec);
+#else
+        return static_cast<std::uint64_t>(std::clock()) * (1000000000u / CLOCKS_PER_SEC);
+#endif
+    }
+
+    /*Bumped by the replacement operator new, stays 0 without INSTRUMENTATION_COUNT_ALLOCATIONS*/
+    inline std::atomic<std::uint64_t> allocations{0};
+
+    inline std::uint64_t allocation_count() noexcept {
+        return allocations.load(std::memory_order_relaxed);
+    }
+
+    /*One perf_event_open group, read in a single syscall*/
+    class hardware_counters {
+        public:
+            static constexpr std::size_t count = 4;
+            static constexpr const char* names[count] = {"cycles", "instructions", "cache_misses", "branch_misses"};
+
+            using values = std::array<std::uint64_t, count>;
+
+            hardware_counters() noexcept {
+#if defined(__linux__)
+                const std::uint64_t configs[count] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                      PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+                for (std::size_t i = 0; i < count; ++i) {
+                    perf_event_attr attr{};
+                    attr.type = PERF_TYPE_HARDWARE;
+                    attr.size = sizeof(attr);
+                    attr.config = configs[i];
+                    attr.disabled = i == 0;
+                    attr.exclude_kernel = 1;
+                    attr.exclude_hv = 1;
+                    attr.read_format = PERF_FORMAT_GROUP;
+                    fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, i == 0 ? -1 : fds_[0], 0));
+                    if (fds_[i] < 0) {
+                        close_all();
+                        return;
+                    }
+                }
+#endif
+            }
+
+            hardware_counters(const hardware_counters&) = delete;
+            hardware_counters& operator=(const hardware_counters&) = delete;
+
+            ~hardware_counters() { close_all(); }
+
+            bool valid() const noexcept { return fds_[0] >= 0; }
+
+            void start() noexcept {
+#if defined(__linux__)
+                if (valid()) {
+                    ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+                    ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+                }
+#endif
+            }
+
+            values stop() noexcept {
+                values result{};
+#if defined(__linux__)
+                if (valid()) {
+                    ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+                    /*PERF_FORMAT_GROUP : the number of events, then one value per event*/
+                    std::uint64_t buffer[1 + count] = {};
+                    if (read(fds_[0], buffer, sizeof(buffer)) == static_cast<ssize_t>(sizeof(buffer))) {
+                        for (std::size_t i = 0; i < count; ++i) {
+                            result[i] = buffer[1 + i];
+                        }
+                    }
+                }
+#endif
+                return result;
+            }
+
+        private:
+            void close_all() noexcept {
+                for (int& fd : fds_) {
+#if defined(__linux__)
+                    if (fd >= 0) {
+                        close(fd);
+                    }
+#endif
+                    fd = -1;
+                }
+            }
+
+            int fds_[count] = {-1, -1, -1, -1};
+    };
+
+    struct sample {
+        std::string name;
+        std::uint64_t iterations = 1;
+        double wall_ns = 0;
+        double cpu_ns = 0;
+        std::uint64_t allocations = 0;
+        bool has_counters = false;
+        hardware_counters::values counters{};
+
+        double ns_per_op() const noexcept { return iterations == 0 ? 0 : wall_ns / iterations; }
+    };
+
+    enum class format { csv, json };
+
+    /*
+     * Collects samples. The process-wide instance() gathers every sample of the run and
+     * writes the report when the program ends, a local recorder only keeps them for its owner.
+     */
+    class recorder {
+        public:
+            static recorder& instance() {
+                static recorder global(true);
+                return global;
+            }
+
+            recorder() : recorder(false) { }
+
+            recorder(const recorder&) = delete;
+            recorder& operator=(const recorder&) = delete;
+
+            ~recorder() {
+                if (!report_at_exit_) {
+                    return;
+                }
+                const char* path = std::getenv("INSTRUMENTATION_REPORT");
+                if (path != nullptr && *path != '\0') {
+                    std::ofstream file(path);
+                    write(file, format_);
+                } else if (!samples_.empty()) {
+                    std::ostringstream buffer;
+                    write(buffer, format_);
+                    std::cout << buffer.str() << std::flush;
+                }
+            }
+
+            bool counters_enabled() const noexcept { return counters_enabled_; }
+
+            void add(sample result) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                samples_.push_back(std::move(result));
+            }
+
+            std::vector<sample> samples() const {
+                std::lock_guard<std::mutex> lock(mutex_);
+                return samples_;
+            }
+
+            /*Times in fixed notation : the default precision would turn 2888180 ns into 2.88818e+06*/
+            void write(std::ostream& out, format kind) const {
+                std::lock_guard<std::mutex> lock(mutex_);
+                std::ios_base::fmtflags flags = out.flags();
+                std::streamsize precision = out.precision();
+                out << std::fixed << std::setprecision(2);
+                if (kind == format::json) {
+                    write_json(out);
+                } else {
+                    write_csv(out);
+                }
+                out.flags(flags);
+                out.precision(precision);
+            }
+
+        private:
+            explicit recorder(bool report_at_exit) : report_at_exit_(report_at_exit) {
+                const char* counters = std::getenv("INSTRUMENTATION_COUNTERS");
+                counters_enabled_ = counters != nullptr && std::string(counters) == "1";
+                const char* kind = std::getenv("INSTRUMENTATION_FORMAT");
+                format_ = kind != nullptr && std::string(kind) == "json" ? format::json : format::csv;
+            }
+
+            void write_csv(std::ostream& out) const {
+                out << "name,iterations,wall_ns,cpu_ns,ns_per_op,allocations";
+                for (const char* counter : hardware_counters::names) {
+                    out << ',' << counter;
+                }
+                out << '\n';
+                for (const sample& result : samples_) {
+                    out << '"';
+                    for (char c : result.name) {
+                        if (c == '"') {
+                            out << '"';
+                        }
+                        out << c;
+                    }
+                    out << "\"," << result.iterations << ',' << result.wall_ns << ',' << result.cpu_ns << ','
+                        << result.ns_per_op() << ',' << result.allocations;
+                    for (std::uint64_t counter : result.counters) {
+                        out << ',';
+                        if (result.has_counters) {
+                            out << counter;
+                        }
+                    }
+                    out << '\n';
+                }
+            }
+
+            void write_json(std::ostream& out) const {
+                out << "[\n";
+                for (std::size_t i = 0; i < samples_.size(); ++i) {
+                    const sample& result = samples_[i];
+                    out << "  {\"name\": \"";
+                    for (char c : result.name) {
+                        if (c == '"' || c == '\\') {
+                            out << '\\' << c;
+                        } else if (static_cast<unsigned char>(c) < 0x20) {
+                            char escaped[8];
+                            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                            out << escaped;
+                        } else {
+                            out << c;
+                        }
+                    }
+                    out << "\", \"iterations\": " << result.iterations << ", \"wall_ns\": " << result.wall_ns
+                        << ", \"cpu_ns\": " << result.cpu_ns << ", \"ns_per_op\": " << result.ns_per_op()
+                        << ", \"allocations\": " << result.allocations;
+                    for (std::size_t c = 0; c < hardware_counters::count; ++c) {
+                        out << ", \"" << hardware_counters::names[c] << "\": ";
+                        if (result.has_counters) {
+                            out << result.counters[c];
+                        } else {
+                            out << "null";
+                        }
+                    }
+                    out << (i + 1 < samples_.size() ? "},\n" : "}\n");
+                }
+                out << "]\n";
+            }
+
+            mutable std::mutex mutex_;
+            std::vector<sample> samples_;
+            bool counters_enabled_ = false;
+            format format_ = format::csv;
+            bool report_at_exit_;
+    };
+
+    /*
+     * Measures from construction to finish() or destruction, recorded into target.
+     * Note : the counters follow the calling thread, wall and CPU time the whole process.
+     */
+    class scope {
+        public:
+            explicit scope(std::string name, std::uint64_t iterations = 1, recorder& target = recorder::instance())
+                : name_(std::move(name)), iterations_(iterations), target_(&target) {
+                if (target_->counters_enabled()) {
+                    counters_.emplace();
+                    counters_->start();
+                }
+                allocations_ = allocation_count();
+                cpu_ = cpu_ns();
+                wall_ = wall_ns();
+            }
+
+            scope(const scope&) = delete;
+            scope& operator=(const scope&) = delete;
+
+            ~scope() { finish(); }
+
+            /*Stops the measurement and returns it, without recording*/
+            sample measure() {
+                sample result;
+                result.wall_ns = static_cast<double>(wall_ns() - wall_);
+                result.cpu_ns = static_cast<double>(cpu_ns() - cpu_);
+                result.allocations = allocation_count() - allocations_;
+                if (counters_ && counters_->valid()) {
+                    result.counters = counters_->stop();
+                    result.has_counters = true;
+                }
+                result.name = name_;
+                result.iterations = iterations_;
+                finished_ = true;
+                return result;
+            }
+
+            void finish() {
+                if (!finished_) {
+                    target_->add(measure());
+                }
+            }
+
+        private:
+            std::string name_;
+            std::uint64_t iterations_;
+            recorder* target_;
+            std::uint64_t wall_ = 0;
+            std::uint64_t cpu_ = 0;
+            std::uint64_t allocations_ = 0;
+            /*Empty unless INSTRUMENTATION_COUNTERS=1, opening the group costs syscalls*/
+            std::optional<hardware_counters> counters_;
+            bool finished_ = false;
+    };
+}
+
+#if defined(INSTRUMENTATION_COUNT_ALLOCATIONS)
+/*Replacement allocation functions : the array and nothrow forms forward to these*/
+void* operator new(std::size_t size) {
+    instrumentation::allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    instrumentation::allocations.fetch_add(1, std::memory_order_relaxed);
+    std::size_t align = static_cast<std::size_t>(alignment);
+    if (void* p = std::aligned_alloc(align, (size + align - 1) / align * align)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+#endif
+
+#endif
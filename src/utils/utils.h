@@ -6,20 +6,19 @@
 #include <boost/test/framework.hpp>
 
 /*others*/
-#include <iostream>
+#include "instrumentation.h"
 
+/*
+ * Times the enclosing test case : wall time, CPU time, allocations and, with
+ * INSTRUMENTATION_COUNTERS=1, hardware counters. Nothing is printed while the tests run,
+ * the samples go to the report written at exit (see instrumentation.h).
+ */
 struct TestLog {
-	TestLog() {
-		std::cout << "\033[1m\033[32m----------- START TEST CASE: " << boost::unit_test::framework::current_test_case().p_name
-                  << "\033[1m\033[32m----------" << std::endl;
-	}
-	~TestLog() {
-		std::cout << "\033[1m\033[31m---------- FINISH TEST CASE: " << boost::unit_test::framework::current_test_case().p_name
-                  << "\033[1m\033[31m----------" << std::endl;
-		std::cout << std::endl;
-	}
+	TestLog() : scope(boost::unit_test::framework::current_test_case().p_name.get()) { }
+
+	instrumentation::scope scope;
 };
 
 #define TEST_LOG() TestLog testLog
 
-#endif
\ No newline at end of file
+#endif